@@ -5,8 +5,8 @@ FILE:             ADXL345.ino
 AUTHOR:           Ing. Mirko Mirabella
                   m.mirabella@neptunengineering.com
                   www.neptunengineering.com
-REVISION:         v. 1.0
-DATE:             19/09/2025
+REVISION:         v. 1.2
+DATE:             27/08/2026
 **********************************************************************************************/
 
 /*
@@ -17,21 +17,40 @@ DATE:             19/09/2025
     - GND -> GND
     - SDA -> A4 (SDA)
     - SCL -> A5 (SCL)
+  Modes:
+    - Polled mode (USE_FIFO_STREAM = 0): one 6-byte register read per SAMPLE_PERIOD_MS.
+    - FIFO-stream mode (USE_FIFO_STREAM = 1): the on-chip 32-entry FIFO buffers samples
+      at the configured output rate; the sketch waits for the watermark interrupt flag
+      and drains the whole batch back-to-back, cutting I2C transactions per sample and
+      allowing output rates far above what per-sample polling sustains.
 */
 
 #include <Wire.h>
 
+// Set to 1 to buffer samples in the on-chip 32-entry FIFO and drain them in bursts.
+#define USE_FIFO_STREAM 0
+
 constexpr uint8_t ADXL345_ADDRESS = 0x53;
 constexpr uint8_t REG_POWER_CTL = 0x2D;
 constexpr uint8_t REG_DATA_FORMAT = 0x31;
 constexpr uint8_t REG_BW_RATE = 0x2C;
+constexpr uint8_t REG_INT_SOURCE = 0x30;
 constexpr uint8_t REG_DATAX0 = 0x32;
+constexpr uint8_t REG_FIFO_CTL = 0x38;
+constexpr uint8_t REG_FIFO_STATUS = 0x39;
 
 constexpr uint8_t MEASURE_BIT = 0x08;
 constexpr uint8_t FULL_RES_BIT = 0x08;
 constexpr uint8_t RANGE_8G = 0x02;
 constexpr uint8_t RATE_100HZ = 0x0A;
 
+constexpr uint8_t FIFO_MODE_BYPASS = 0x00;
+constexpr uint8_t FIFO_MODE_STREAM = 0x80;
+constexpr uint8_t FIFO_WATERMARK_BIT = 0x02;     // INT_SOURCE: watermark reached
+constexpr uint8_t FIFO_ENTRIES_MASK = 0x3F;      // FIFO_STATUS: entries held
+constexpr uint8_t FIFO_WATERMARK_SAMPLES = 25;   // legal range 1..31; 0 is invalid
+                                                 // (flag would assert immediately)
+
 constexpr float G_PER_LSB = 0.0039f; // 3.9 mg/LSB in full-resolution mode
 constexpr uint16_t CALIBRATION_SAMPLES = 200;
 constexpr uint16_t CALIBRATION_SAMPLE_DELAY_MS = 5;
@@ -50,6 +69,8 @@ bool readRegisters(uint8_t startReg, uint8_t *buffer, size_t length);
 bool initializeADXL345();
 bool readRawAcceleration(Vector3 &raw);
 bool readAcceleration(Vector3 &measurement);
+bool fifoWatermarkReached();
+uint8_t readAccelerationBatch(Vector3 *batch, uint8_t maxSamples);
 void calibrateADXL345();
 void printAcceleration(const Vector3 &g);
 float vectorMagnitude(const Vector3 &v);
@@ -73,6 +94,22 @@ void setup() {
 }
 
 void loop() {
+#if USE_FIFO_STREAM
+  if (!fifoWatermarkReached()) {
+    return;
+  }
+
+  Vector3 batch[FIFO_WATERMARK_SAMPLES];
+  const uint8_t count = readAccelerationBatch(batch, FIFO_WATERMARK_SAMPLES);
+  if (count == 0) {
+    Serial.println(F("Failed to drain the FIFO."));
+    return;
+  }
+
+  for (uint8_t i = 0; i < count; ++i) {
+    printAcceleration(batch[i]);
+  }
+#else
   static unsigned long lastSampleMs = 0;
   const unsigned long now = millis();
   if (now - lastSampleMs < SAMPLE_PERIOD_MS) {
@@ -87,6 +124,7 @@ void loop() {
   }
 
   printAcceleration(measurement);
+#endif
 }
 
 bool writeRegister(uint8_t reg, uint8_t value) {
@@ -129,6 +167,20 @@ bool initializeADXL345() {
     return false;
   }
 
+#if USE_FIFO_STREAM
+  // Stream mode keeps the newest 32 samples and raises the watermark flag once
+  // FIFO_WATERMARK_SAMPLES entries are pending. The five low bits hold the
+  // threshold; the datasheet forbids 0 (the flag would assert with an empty FIFO),
+  // so the legal range is 1..31 and a few entries of headroom are left on purpose.
+  if (!writeRegister(REG_FIFO_CTL, FIFO_MODE_STREAM | (FIFO_WATERMARK_SAMPLES & 0x1F))) {
+    return false;
+  }
+#else
+  if (!writeRegister(REG_FIFO_CTL, FIFO_MODE_BYPASS)) {
+    return false;
+  }
+#endif
+
   if (!writeRegister(REG_POWER_CTL, MEASURE_BIT)) {
     return false;
   }
@@ -167,6 +219,45 @@ bool readAcceleration(Vector3 &measurement) {
   return true;
 }
 
+bool fifoWatermarkReached() {
+  uint8_t intSource;
+  if (!readRegisters(REG_INT_SOURCE, &intSource, 1)) {
+    return false;
+  }
+  return (intSource & FIFO_WATERMARK_BIT) != 0;
+}
+
+// Drains up to maxSamples entries from the FIFO with back-to-back 6-byte bursts.
+// Each read of DATAX0..DATAZ1 pops one FIFO entry, so no per-sample polling or
+// SAMPLE_PERIOD_MS pacing is needed. Returns the number of samples stored in batch.
+uint8_t readAccelerationBatch(Vector3 *batch, uint8_t maxSamples) {
+  uint8_t fifoStatus;
+  if (!readRegisters(REG_FIFO_STATUS, &fifoStatus, 1)) {
+    return 0;
+  }
+
+  uint8_t pending = fifoStatus & FIFO_ENTRIES_MASK;
+  if (pending > maxSamples) {
+    pending = maxSamples;
+  }
+
+  uint8_t count = 0;
+  for (; count < pending; ++count) {
+    Vector3 raw;
+    if (!readRawAcceleration(raw)) {
+      break;
+    }
+    batch[count].x = raw.x - bias.x;
+    batch[count].y = raw.y - bias.y;
+    batch[count].z = raw.z - bias.z;
+    // Datasheet: allow at least 5 us between the end of a FIFO read and the next
+    // read's start so the FIFO pointer can advance.
+    delayMicroseconds(5);
+  }
+
+  return count;
+}
+
 void calibrateADXL345() {
   Vector3 sum = {0.0f, 0.0f, 0.0f};
   uint16_t collected = 0;
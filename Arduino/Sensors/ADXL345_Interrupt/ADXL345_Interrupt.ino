@@ -0,0 +1,214 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        Arduino/Sensors/ADXL345_Interrupt
+FILE:             ADXL345_Interrupt.ino
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  ADXL345 Interrupt-Driven Sampling Snippet
+  Event-driven variant of the ADXL345 quickstart sketch: instead of polling on a fixed
+  SAMPLE_PERIOD_MS schedule, the sensor's DATA_READY output (INT1) wakes the MCU, the
+  sample is read immediately (no polling jitter) and pushed into a lock-free SPSC ring
+  buffer, and Serial output drains the buffer in batches so sampling never waits on the
+  UART. Between events the MCU sleeps in idle mode, which cuts average current on
+  battery-powered loggers.
+
+  Note: the ISR only raises a flag — I2C transactions stay out of interrupt context
+  because the Wire library itself is interrupt-driven and would deadlock.
+
+  Wiring (Arduino Uno):
+    - VCC -> 3.3V, GND -> GND, SDA -> A4, SCL -> A5
+    - INT1 -> D2 (external interrupt 0)
+*/
+
+#include <Wire.h>
+#if defined(ARDUINO_ARCH_AVR)
+#include <avr/sleep.h>
+#endif
+
+#include "SpscRingBuffer.h"
+
+constexpr uint8_t ADXL345_ADDRESS = 0x53;
+constexpr uint8_t REG_POWER_CTL = 0x2D;
+constexpr uint8_t REG_INT_ENABLE = 0x2E;
+constexpr uint8_t REG_INT_MAP = 0x2F;
+constexpr uint8_t REG_INT_SOURCE = 0x30;
+constexpr uint8_t REG_DATA_FORMAT = 0x31;
+constexpr uint8_t REG_BW_RATE = 0x2C;
+constexpr uint8_t REG_DATAX0 = 0x32;
+
+constexpr uint8_t MEASURE_BIT = 0x08;
+constexpr uint8_t FULL_RES_BIT = 0x08;
+constexpr uint8_t RANGE_8G = 0x02;
+constexpr uint8_t RATE_100HZ = 0x0A;
+constexpr uint8_t DATA_READY_BIT = 0x80;
+
+constexpr uint8_t INT1_PIN = 2;
+constexpr float G_PER_LSB = 0.0039f; // 3.9 mg/LSB in full-resolution mode
+constexpr uint8_t DRAIN_BATCH = 8;   // samples printed per drain pass
+
+struct Vector3 {
+  float x;
+  float y;
+  float z;
+};
+
+SpscRingBuffer<Vector3, 64> samples;
+volatile bool dataReady = false;
+uint16_t droppedSamples = 0;
+
+bool writeRegister(uint8_t reg, uint8_t value);
+bool readRegisters(uint8_t startReg, uint8_t *buffer, size_t length);
+bool initializeADXL345();
+bool readRawAcceleration(Vector3 &raw);
+void onDataReady();
+void printAcceleration(const Vector3 &g);
+
+void setup() {
+  Serial.begin(115200);
+  delay(50);
+
+  Wire.begin();
+  Wire.setClock(400000); // keep the read shorter than one 100 Hz sample period
+
+  if (!initializeADXL345()) {
+    Serial.println(F("ADXL345 initialization failed. Check wiring and power."));
+    while (true) {
+      delay(1000);
+    }
+  }
+
+  pinMode(INT1_PIN, INPUT);
+  attachInterrupt(digitalPinToInterrupt(INT1_PIN), onDataReady, RISING);
+
+  // Clear any latched interrupt so the first edge can fire.
+  uint8_t intSource;
+  readRegisters(REG_INT_SOURCE, &intSource, 1);
+
+  Serial.println(F("Interrupt-driven streaming started."));
+}
+
+void loop() {
+  if (dataReady) {
+    dataReady = false;
+
+    Vector3 raw;
+    if (readRawAcceleration(raw) && !samples.push(raw)) {
+      ++droppedSamples; // consumer fell behind; keep sampling regardless
+    }
+  }
+
+  // Drain in batches so one slow Serial line never delays the next sample.
+  if (samples.size() >= DRAIN_BATCH) {
+    Vector3 v;
+    for (uint8_t i = 0; i < DRAIN_BATCH && samples.pop(v); ++i) {
+      printAcceleration(v);
+    }
+    if (droppedSamples > 0) {
+      Serial.print(F("Dropped samples: "));
+      Serial.println(droppedSamples);
+      droppedSamples = 0;
+    }
+    return; // skip the sleep while there is backlog to flush
+  }
+
+#if defined(ARDUINO_ARCH_AVR)
+  // Idle until the next DATA_READY edge (timers and UART keep running).
+  set_sleep_mode(SLEEP_MODE_IDLE);
+  sleep_enable();
+  sleep_cpu();
+  sleep_disable();
+#endif
+}
+
+void onDataReady() {
+  dataReady = true; // reading over I2C happens in loop(), outside the ISR
+}
+
+bool writeRegister(uint8_t reg, uint8_t value) {
+  Wire.beginTransmission(ADXL345_ADDRESS);
+  Wire.write(reg);
+  Wire.write(value);
+  return Wire.endTransmission() == 0;
+}
+
+bool readRegisters(uint8_t startReg, uint8_t *buffer, size_t length) {
+  Wire.beginTransmission(ADXL345_ADDRESS);
+  Wire.write(startReg);
+  if (Wire.endTransmission(false) != 0) {
+    return false;
+  }
+
+  const uint8_t bytesRequested = static_cast<uint8_t>(length);
+  const uint8_t bytesRead = Wire.requestFrom(ADXL345_ADDRESS, bytesRequested, true);
+  if (bytesRead != bytesRequested) {
+    return false;
+  }
+
+  for (size_t i = 0; i < length; ++i) {
+    buffer[i] = static_cast<uint8_t>(Wire.read());
+  }
+  return true;
+}
+
+bool initializeADXL345() {
+  if (!writeRegister(REG_POWER_CTL, 0x00)) { // ensure standby
+    return false;
+  }
+  delay(5);
+
+  if (!writeRegister(REG_DATA_FORMAT, FULL_RES_BIT | RANGE_8G)) {
+    return false;
+  }
+
+  if (!writeRegister(REG_BW_RATE, RATE_100HZ)) {
+    return false;
+  }
+
+  // Route DATA_READY to INT1 (bit cleared in INT_MAP) and enable it.
+  if (!writeRegister(REG_INT_MAP, 0x00)) {
+    return false;
+  }
+  if (!writeRegister(REG_INT_ENABLE, DATA_READY_BIT)) {
+    return false;
+  }
+
+  if (!writeRegister(REG_POWER_CTL, MEASURE_BIT)) {
+    return false;
+  }
+
+  delay(10);
+  return true;
+}
+
+bool readRawAcceleration(Vector3 &raw) {
+  uint8_t buffer[6];
+  if (!readRegisters(REG_DATAX0, buffer, sizeof(buffer))) {
+    return false;
+  }
+
+  const int16_t x = static_cast<int16_t>((static_cast<int16_t>(buffer[1]) << 8) | buffer[0]);
+  const int16_t y = static_cast<int16_t>((static_cast<int16_t>(buffer[3]) << 8) | buffer[2]);
+  const int16_t z = static_cast<int16_t>((static_cast<int16_t>(buffer[5]) << 8) | buffer[4]);
+
+  raw.x = static_cast<float>(x) * G_PER_LSB;
+  raw.y = static_cast<float>(y) * G_PER_LSB;
+  raw.z = static_cast<float>(z) * G_PER_LSB;
+
+  return true;
+}
+
+void printAcceleration(const Vector3 &g) {
+  Serial.print(F("X: "));
+  Serial.print(g.x, 3);
+  Serial.print(F(" g  Y: "));
+  Serial.print(g.y, 3);
+  Serial.print(F(" g  Z: "));
+  Serial.print(g.z, 3);
+  Serial.println(F(" g"));
+}
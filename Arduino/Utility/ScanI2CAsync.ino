@@ -0,0 +1,158 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        Arduino/Utility
+FILE:             ScanI2CAsync.ino
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  Non-Blocking I2C Bus Scanner Snippet
+  State-machine variant of ScanI2C.ino for sketches that must keep servicing a control
+  loop while hot-plug detecting sensors. Each loop() pass probes at most one address, so
+  the per-iteration latency stays bounded by a single Wire transaction instead of a full
+  127-address sweep. Results are delivered through a callback as they are discovered, and
+  sweeps repeat continuously with a configurable pause in between.
+  Wiring (Arduino Uno defaults):
+    - SDA -> A4
+    - SCL -> A5
+    - Pull-up resistors (4.7 kOhm typical) to 3.3V or 5V as required by your bus
+  Usage:
+    1. Adjust I2C_BUS_FREQUENCY (100k/400k/1M) to trade sweep time against bus limits.
+    2. Replace onDeviceFound()/onScanComplete() with your own handlers.
+    3. Upload and open the Serial Monitor at 115200 baud; note the control loop counter
+       keeps incrementing while the sweep is in progress.
+*/
+
+#include <Wire.h>
+
+constexpr unsigned long RESCAN_PAUSE_MS = 3000;
+constexpr uint32_t I2C_BUS_FREQUENCY = 400000; // 100000 / 400000 / 1000000
+constexpr uint8_t I2C_ADDRESS_MIN = 0x01;
+constexpr uint8_t I2C_ADDRESS_MAX = 0x7F; // 7-bit addressing upper bound (exclusive)
+
+// Callback types so the scanner core stays reusable across sketches.
+using DeviceFoundCallback = void (*)(uint8_t address);
+using ScanCompleteCallback = void (*)(uint8_t devicesFound, unsigned long durationMs);
+
+enum class ScannerState : uint8_t {
+  Idle,     // waiting for the rescan pause to elapse
+  Probing,  // sweeping addresses, one per service() call
+};
+
+class AsyncI2CScanner {
+ public:
+  void begin(DeviceFoundCallback onFound, ScanCompleteCallback onComplete) {
+    onFound_ = onFound;
+    onComplete_ = onComplete;
+    state_ = ScannerState::Idle;
+    lastSweepEndMs_ = 0;
+  }
+
+  // Call from loop() (or a timer interrupt). Probes at most one address per call.
+  void service() {
+    const unsigned long now = millis();
+
+    switch (state_) {
+      case ScannerState::Idle:
+        if (lastSweepEndMs_ != 0 && (now - lastSweepEndMs_) < RESCAN_PAUSE_MS) {
+          return;
+        }
+        nextAddress_ = I2C_ADDRESS_MIN;
+        devicesFound_ = 0;
+        sweepStartMs_ = now;
+        state_ = ScannerState::Probing;
+        return;
+
+      case ScannerState::Probing:
+        probeOneAddress();
+        if (nextAddress_ >= I2C_ADDRESS_MAX) {
+          lastSweepEndMs_ = millis();
+          state_ = ScannerState::Idle;
+          if (onComplete_ != nullptr) {
+            onComplete_(devicesFound_, lastSweepEndMs_ - sweepStartMs_);
+          }
+        }
+        return;
+    }
+  }
+
+ private:
+  void probeOneAddress() {
+    Wire.beginTransmission(nextAddress_);
+    const uint8_t error = Wire.endTransmission();
+    if (error == 0) {
+      ++devicesFound_;
+      if (onFound_ != nullptr) {
+        onFound_(nextAddress_);
+      }
+    }
+    ++nextAddress_;
+  }
+
+  DeviceFoundCallback onFound_ = nullptr;
+  ScanCompleteCallback onComplete_ = nullptr;
+  ScannerState state_ = ScannerState::Idle;
+  uint8_t nextAddress_ = I2C_ADDRESS_MIN;
+  uint8_t devicesFound_ = 0;
+  unsigned long sweepStartMs_ = 0;
+  unsigned long lastSweepEndMs_ = 0;
+};
+
+AsyncI2CScanner scanner;
+unsigned long controlLoopIterations = 0;
+
+void onDeviceFound(uint8_t address);
+void onScanComplete(uint8_t devicesFound, unsigned long durationMs);
+
+void setup() {
+  Serial.begin(115200);
+  const unsigned long serialStart = millis();
+  while (!Serial && (millis() - serialStart) < 2000) {
+    // Wait for Serial monitor (useful on boards with native USB)
+  }
+
+  Wire.begin();
+  Wire.setClock(I2C_BUS_FREQUENCY);
+
+  Serial.println(F("\nNon-blocking I2C bus scanner ready."));
+  Serial.print(F("Bus speed: "));
+  Serial.print(I2C_BUS_FREQUENCY / 1000);
+  Serial.println(F(" kHz"));
+
+  scanner.begin(onDeviceFound, onScanComplete);
+}
+
+void loop() {
+  scanner.service();
+
+  // Stand-in for the application's control loop: keeps running during the sweep.
+  ++controlLoopIterations;
+}
+
+void onDeviceFound(uint8_t address) {
+  Serial.print(F("  0x"));
+  if (address < 16) {
+    Serial.print('0');
+  }
+  Serial.print(address, HEX);
+  Serial.println(F(" (ACK)"));
+}
+
+void onScanComplete(uint8_t devicesFound, unsigned long durationMs) {
+  if (devicesFound == 0) {
+    Serial.println(F("No I2C devices responded."));
+  }
+
+  Serial.print(F("Sweep complete: "));
+  Serial.print(devicesFound);
+  Serial.print(devicesFound == 1 ? F(" device") : F(" devices"));
+  Serial.print(F(" | Duration: "));
+  Serial.print(durationMs);
+  Serial.print(F(" ms | Control loop iterations meanwhile: "));
+  Serial.println(controlLoopIterations);
+  controlLoopIterations = 0;
+}
@@ -0,0 +1,143 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        C/DataStructures
+FILE:             freelist_pool.h
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  Freelist Fixed-Block Pool Snippet
+  Constant-time allocator over a caller-provided buffer: free blocks are threaded into a
+  LIFO freelist (see the singly linked list in intrusive_list.h), so alloc and free are
+  a pointer swap each, fragmentation is impossible by construction, and everything stays
+  in one cache-resident arena. The C sibling of Cpp/Memory/ObjectPool.hpp, usable from
+  Arduino and STM32 C code alike.
+
+  Complexity:     O(1) alloc/free; O(blocks) one-time init; zero heap usage.
+  Requirements:   C99 (also compiles as C++). Block size is rounded up to hold the
+                  freelist pointer and keep alignment.
+
+  Usage:
+    static unsigned char storage[32 * sizeof(connection_t)];
+    freelist_pool pool;
+    freelist_pool_init(&pool, storage, sizeof(storage), sizeof(connection_t));
+    connection_t *conn = (connection_t *)freelist_pool_alloc(&pool);
+    ...
+    freelist_pool_free(&pool, conn);
+*/
+
+#ifndef FREELIST_POOL_H
+#define FREELIST_POOL_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct freelist_block {
+  struct freelist_block *next;
+} freelist_block;
+
+typedef struct {
+  freelist_block *free_head;
+  size_t block_size;  /* rounded-up size actually consumed per block */
+  size_t block_count; /* total blocks carved from the buffer */
+  size_t available;   /* blocks currently on the freelist */
+} freelist_pool;
+
+/* Rounds the block size up so every block can hold the freelist pointer and
+   subsequent blocks stay pointer-aligned. */
+static inline size_t freelist_pool_round_block(size_t requested) {
+  const size_t align = sizeof(void *);
+  size_t size = requested < sizeof(freelist_block) ? sizeof(freelist_block) : requested;
+  return (size + align - 1) & ~(align - 1);
+}
+
+/* Carves `buffer_size` bytes into blocks of `block_size` (rounded up) and threads
+   them all onto the freelist. Returns the number of usable blocks (0 on error). */
+static inline size_t freelist_pool_init(freelist_pool *pool, void *buffer,
+                                        size_t buffer_size, size_t block_size) {
+  unsigned char *cursor = (unsigned char *)buffer;
+  size_t rounded = freelist_pool_round_block(block_size);
+  size_t count = buffer_size / rounded;
+  size_t i;
+
+  pool->free_head = NULL;
+  pool->block_size = rounded;
+  pool->block_count = count;
+  pool->available = count;
+
+  /* Thread back-to-front so allocation order matches buffer order (cache-friendly). */
+  for (i = count; i > 0; --i) {
+    freelist_block *block = (freelist_block *)(cursor + (i - 1) * rounded);
+    block->next = pool->free_head;
+    pool->free_head = block;
+  }
+  return count;
+}
+
+/* Pops a block in O(1); NULL when the pool is exhausted. Contents are uninitialized. */
+static inline void *freelist_pool_alloc(freelist_pool *pool) {
+  freelist_block *block = pool->free_head;
+  if (block == NULL) {
+    return NULL;
+  }
+  pool->free_head = block->next;
+  --pool->available;
+  return block;
+}
+
+/* Pushes a block back in O(1). The pointer must come from this pool. */
+static inline void freelist_pool_free(freelist_pool *pool, void *ptr) {
+  freelist_block *block = (freelist_block *)ptr;
+  if (block == NULL) {
+    return;
+  }
+  block->next = pool->free_head;
+  pool->free_head = block;
+  ++pool->available;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FREELIST_POOL_H */
+
+/*
+  Demo build:
+    gcc -std=c99 -O2 -DFREELIST_POOL_DEMO -x c freelist_pool.h -o pool_demo
+*/
+#ifdef FREELIST_POOL_DEMO
+#include <stdint.h>
+#include <stdio.h>
+
+typedef struct {
+  uint8_t address;
+  uint32_t last_seen_ms;
+} connection_t;
+
+int main(void) {
+  static unsigned char storage[8 * sizeof(connection_t)];
+  freelist_pool pool;
+  const size_t blocks =
+      freelist_pool_init(&pool, storage, sizeof(storage), sizeof(connection_t));
+
+  connection_t *a = (connection_t *)freelist_pool_alloc(&pool);
+  connection_t *b = (connection_t *)freelist_pool_alloc(&pool);
+  a->address = 0x53;
+  b->address = 0x68;
+
+  freelist_pool_free(&pool, a);
+  connection_t *c = (connection_t *)freelist_pool_alloc(&pool); /* reuses a's block */
+
+  printf("blocks=%zu reused=%s available=%zu\n", blocks, c == a ? "yes" : "no",
+         pool.available);
+  return (blocks >= 8 && c == a && pool.available == blocks - 2) ? 0 : 1;
+}
+#endif /* FREELIST_POOL_DEMO */
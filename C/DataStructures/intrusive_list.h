@@ -0,0 +1,169 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        C/DataStructures
+FILE:             intrusive_list.h
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  Intrusive Linked List Snippet
+  Singly and doubly linked lists whose node lives inside the user's struct, so there is
+  no per-element allocation and removal from the doubly linked list is an O(1) pointer
+  swap given the element itself — the upgrade path for firmware that tracks connections
+  or timers with O(n) array scans today. Shared by the Arduino and STM32 families (plain
+  C99, no dependencies).
+
+  Complexity:     push/pop/unlink O(1); iteration O(n); zero allocation.
+  Requirements:   C99 (also compiles as C++).
+
+  Usage:
+    typedef struct {
+      uint8_t address;
+      ilist_node node;     // embedded, no allocation
+    } device_t;
+
+    ilist_node active;     // list head (sentinel)
+    ilist_init(&active);
+    ilist_push_back(&active, &dev->node);
+    ilist_remove(&dev->node);                 // O(1), no head needed
+    ilist_for_each(it, &active) {
+      device_t *dev = ilist_entry(it, device_t, node);
+    }
+*/
+
+#ifndef INTRUSIVE_LIST_H
+#define INTRUSIVE_LIST_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ------------------------------ doubly linked list ------------------------------ */
+
+typedef struct ilist_node {
+  struct ilist_node *prev;
+  struct ilist_node *next;
+} ilist_node;
+
+/* Recovers the containing struct from an embedded node pointer. */
+#define ilist_entry(node_ptr, type, member) \
+  ((type *)((char *)(node_ptr)-offsetof(type, member)))
+
+/* Iterates over the list; do not unlink `it` while iterating (use _safe below). */
+#define ilist_for_each(it, head) \
+  for (ilist_node *it = (head)->next; it != (head); it = it->next)
+
+/* Iteration that survives unlinking the current node. */
+#define ilist_for_each_safe(it, tmp, head)                            \
+  for (ilist_node *it = (head)->next, *tmp = it->next; it != (head); \
+       it = tmp, tmp = it->next)
+
+/* Initializes a sentinel head (an empty circular list). */
+static inline void ilist_init(ilist_node *head) {
+  head->prev = head;
+  head->next = head;
+}
+
+static inline int ilist_empty(const ilist_node *head) { return head->next == head; }
+
+static inline void ilist_insert_between(ilist_node *node, ilist_node *prev,
+                                        ilist_node *next) {
+  node->prev = prev;
+  node->next = next;
+  prev->next = node;
+  next->prev = node;
+}
+
+static inline void ilist_push_front(ilist_node *head, ilist_node *node) {
+  ilist_insert_between(node, head, head->next);
+}
+
+static inline void ilist_push_back(ilist_node *head, ilist_node *node) {
+  ilist_insert_between(node, head->prev, head);
+}
+
+/* O(1) unlink given only the element; the node is left self-linked (safe to re-remove). */
+static inline void ilist_remove(ilist_node *node) {
+  node->prev->next = node->next;
+  node->next->prev = node->prev;
+  node->prev = node;
+  node->next = node;
+}
+
+/* ------------------------------ singly linked list ------------------------------ */
+
+typedef struct islist_node {
+  struct islist_node *next;
+} islist_node;
+
+typedef struct {
+  islist_node *head;
+} islist;
+
+static inline void islist_init(islist *list) { list->head = NULL; }
+
+static inline int islist_empty(const islist *list) { return list->head == NULL; }
+
+/* LIFO push: the freelist/stack pattern (see freelist_pool.h). */
+static inline void islist_push(islist *list, islist_node *node) {
+  node->next = list->head;
+  list->head = node;
+}
+
+static inline islist_node *islist_pop(islist *list) {
+  islist_node *node = list->head;
+  if (node != NULL) {
+    list->head = node->next;
+    node->next = NULL;
+  }
+  return node;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INTRUSIVE_LIST_H */
+
+/*
+  Demo build:
+    gcc -std=c99 -O2 -DINTRUSIVE_LIST_DEMO -x c intrusive_list.h -o ilist_demo
+*/
+#ifdef INTRUSIVE_LIST_DEMO
+#include <stdint.h>
+#include <stdio.h>
+
+typedef struct {
+  uint8_t address;
+  ilist_node node;
+} device_t;
+
+int main(void) {
+  ilist_node active;
+  ilist_init(&active);
+
+  device_t devices[3] = {{0x3C, {0, 0}}, {0x53, {0, 0}}, {0x68, {0, 0}}};
+  for (int i = 0; i < 3; ++i) {
+    ilist_push_back(&active, &devices[i].node);
+  }
+
+  ilist_remove(&devices[1].node); /* O(1), no list scan */
+
+  int count = 0;
+  ilist_for_each(it, &active) {
+    device_t *dev = ilist_entry(it, device_t, node);
+    printf("device 0x%02X\n", dev->address);
+    ++count;
+  }
+
+  printf(count == 2 && !ilist_empty(&active) ? "intrusive_list OK\n"
+                                             : "intrusive_list FAILED\n");
+  return count == 2 ? 0 : 1;
+}
+#endif /* INTRUSIVE_LIST_DEMO */
@@ -0,0 +1,258 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        Cpp/Benchmark
+FILE:             CycleCounter.hpp
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  Hot-Path Cycle Counter Instrumentation Snippet
+  In-situ complement of MicroBenchmark.hpp: SCOPED_TIMER(name) brackets a scope with the
+  cheapest cycle/time source the target offers and accumulates min/max/mean per named
+  site in static storage, so you can see where the sampling budget of a sketch or
+  control loop actually goes on-device.
+
+  Tick sources:
+    - Cortex-M (STM32): DWT cycle counter (call cyclecounter::enableDwt() once).
+    - AVR (Arduino):    micros(), i.e. the TCNT0-derived 4 us tick.
+    - x86/x86_64:       rdtsc.
+    - anything else:    std::chrono::steady_clock nanoseconds.
+
+  Define CYCLE_COUNTER_ENABLED=0 to compile every macro away to nothing — zero code,
+  zero data, zero cycles in release firmware.
+
+  Complexity:     two counter reads + a handful of integer ops per timed scope.
+  Requirements:   C++17 host / C++11 embedded cores; no dependencies.
+
+  Usage:
+    void loop() {
+      { SCOPED_TIMER("i2c read");   readRawAcceleration(raw); }
+      { SCOPED_TIMER("formatting"); printAcceleration(raw); }
+      if (++iterations % 1000 == 0) {
+        cyclecounter::forEachSite([](const cyclecounter::SiteStats &s) {
+          printf("%-12s n=%lu min=%lu max=%lu mean=%lu\n", s.name,
+                 (unsigned long)s.count, (unsigned long)s.minCycles,
+                 (unsigned long)s.maxCycles, (unsigned long)(s.sumCycles / s.count));
+        });
+      }
+    }
+*/
+
+#ifndef CYCLE_COUNTER_HPP
+#define CYCLE_COUNTER_HPP
+
+#ifndef CYCLE_COUNTER_ENABLED
+#define CYCLE_COUNTER_ENABLED 1
+#endif
+
+#include <stdint.h>
+
+#if CYCLE_COUNTER_ENABLED
+
+#if defined(__CORTEX_M) || defined(STM32F4) || defined(STM32F7) || defined(STM32H7) || \
+    defined(STM32L4) || defined(STM32G4)
+#define CYCLE_COUNTER_DWT 1
+#elif defined(__AVR__)
+#include <Arduino.h>
+#define CYCLE_COUNTER_AVR 1
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define CYCLE_COUNTER_TSC 1
+#else
+#include <chrono>
+#endif
+
+namespace cyclecounter {
+
+#if defined(CYCLE_COUNTER_DWT)
+// DWT registers are architectural on Cortex-M3/M4/M7 — no HAL dependency needed.
+namespace dwt {
+inline volatile uint32_t &demcr() {
+  return *reinterpret_cast<volatile uint32_t *>(0xE000EDFCu);
+}
+inline volatile uint32_t &ctrl() {
+  return *reinterpret_cast<volatile uint32_t *>(0xE0001000u);
+}
+inline volatile uint32_t &cyccnt() {
+  return *reinterpret_cast<volatile uint32_t *>(0xE0001004u);
+}
+} // namespace dwt
+
+/// Call once at startup (Cortex-M only): enables the DWT cycle counter.
+inline void enableDwt() {
+  dwt::demcr() |= 1u << 24; // TRCENA
+  dwt::cyccnt() = 0;
+  dwt::ctrl() |= 1u; // CYCCNTENA
+}
+
+inline uint32_t now() { return dwt::cyccnt(); }
+#elif defined(CYCLE_COUNTER_AVR)
+inline void enableDwt() {}
+inline uint32_t now() { return micros(); } // 4 us granularity on a 16 MHz Uno
+#elif defined(CYCLE_COUNTER_TSC)
+inline void enableDwt() {}
+inline uint32_t now() { return static_cast<uint32_t>(__rdtsc()); }
+#else
+inline void enableDwt() {}
+inline uint32_t now() {
+  return static_cast<uint32_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+#endif
+
+/// Accumulated statistics for one instrumented site; lives in static storage and is
+/// linked into a global registry on first use (no allocation, no registration call).
+struct SiteStats {
+  const char *name;
+  uint32_t count = 0;
+  uint32_t minCycles = 0xFFFFFFFFu;
+  uint32_t maxCycles = 0;
+  uint64_t sumCycles = 0;
+  SiteStats *nextSite = nullptr;
+
+  explicit SiteStats(const char *siteName) : name(siteName) {
+    nextSite = registryHead();
+    registryHead() = this;
+  }
+
+  void record(uint32_t cycles) {
+    ++count;
+    sumCycles += cycles;
+    if (cycles < minCycles) {
+      minCycles = cycles;
+    }
+    if (cycles > maxCycles) {
+      maxCycles = cycles;
+    }
+  }
+
+  void reset() {
+    count = 0;
+    minCycles = 0xFFFFFFFFu;
+    maxCycles = 0;
+    sumCycles = 0;
+  }
+
+  static SiteStats *&registryHead() {
+    static SiteStats *head = nullptr;
+    return head;
+  }
+};
+
+/// Visits every instrumented site (declaration order is reversed: last first).
+template <typename Fn>
+inline void forEachSite(Fn &&fn) {
+  for (SiteStats *site = SiteStats::registryHead(); site != nullptr;
+       site = site->nextSite) {
+    if (site->count > 0) {
+      fn(*site);
+    }
+  }
+}
+
+inline void resetAll() {
+  for (SiteStats *site = SiteStats::registryHead(); site != nullptr;
+       site = site->nextSite) {
+    site->reset();
+  }
+}
+
+/// RAII scope bracket: reads the counter on entry and records the delta on exit.
+class ScopedTimer {
+ public:
+  explicit ScopedTimer(SiteStats &stats) : stats_(stats), start_(now()) {}
+  ~ScopedTimer() { stats_.record(now() - start_); }
+
+  ScopedTimer(const ScopedTimer &) = delete;
+  ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+ private:
+  SiteStats &stats_;
+  uint32_t start_;
+};
+
+} // namespace cyclecounter
+
+#define CYCLE_COUNTER_CONCAT2(a, b) a##b
+#define CYCLE_COUNTER_CONCAT(a, b) CYCLE_COUNTER_CONCAT2(a, b)
+
+/// Times the enclosing scope and accumulates under `name` (a string literal).
+#define SCOPED_TIMER(name)                                                     \
+  static cyclecounter::SiteStats CYCLE_COUNTER_CONCAT(scopedTimerStats_,       \
+                                                      __LINE__){name};         \
+  cyclecounter::ScopedTimer CYCLE_COUNTER_CONCAT(scopedTimer_, __LINE__)(      \
+      CYCLE_COUNTER_CONCAT(scopedTimerStats_, __LINE__))
+
+#else // !CYCLE_COUNTER_ENABLED
+
+namespace cyclecounter {
+struct SiteStats;
+inline void enableDwt() {}
+template <typename Fn>
+inline void forEachSite(Fn &&) {}
+inline void resetAll() {}
+} // namespace cyclecounter
+
+#define SCOPED_TIMER(name) ((void)0)
+
+#endif // CYCLE_COUNTER_ENABLED
+
+#endif // CYCLE_COUNTER_HPP
+
+/*
+  Demo build:
+    g++ -std=c++17 -O2 -DCYCLE_COUNTER_DEMO -x c++ CycleCounter.hpp -o cycles_demo
+*/
+#ifdef CYCLE_COUNTER_DEMO
+#include <cmath>
+#include <cstdio>
+
+namespace {
+volatile double sink = 0.0;
+
+void fastPath() {
+  SCOPED_TIMER("fast path");
+  sink = sink + 1.0;
+}
+
+void slowPath() {
+  SCOPED_TIMER("slow path");
+  for (int i = 0; i < 100; ++i) {
+    sink = std::sqrt(sink + i);
+  }
+}
+} // namespace
+
+int main() {
+  for (int i = 0; i < 10000; ++i) {
+    fastPath();
+    if (i % 10 == 0) {
+      slowPath();
+    }
+  }
+
+  // Reporting code references SiteStats fields, so it is guarded the same way
+  // release firmware would guard its report-over-serial block.
+#if CYCLE_COUNTER_ENABLED
+  int sites = 0;
+  cyclecounter::forEachSite([&sites](const cyclecounter::SiteStats &s) {
+    ++sites;
+    std::printf("%-10s n=%8lu  min=%8lu  max=%8lu  mean=%8lu\n", s.name,
+                static_cast<unsigned long>(s.count),
+                static_cast<unsigned long>(s.minCycles),
+                static_cast<unsigned long>(s.maxCycles),
+                static_cast<unsigned long>(s.sumCycles / s.count));
+  });
+  return sites == 2 ? 0 : 1;
+#else
+  std::printf("instrumentation compiled out\n");
+  return 0;
+#endif
+}
+#endif // CYCLE_COUNTER_DEMO
@@ -0,0 +1,184 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        Cpp/Benchmark
+FILE:             MicroBenchmark.hpp
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  Micro-Benchmark Harness Snippet
+  C++ counterpart of Python/Time/time_count.py for measuring the snippets in this folder.
+  Wraps steady_clock timing with automatic iteration-count calibration (so each sample runs
+  long enough to dwarf clock overhead), repeats the measurement to report median/p99/stddev
+  rather than a single noisy number, and provides a DoNotOptimize() barrier so the compiler
+  cannot delete the benchmarked expression.
+
+  Complexity:     measurement overhead amortized below 1 ns/op after calibration.
+  Requirements:   C++17, <chrono>; the asm barrier targets GCC/Clang (MSVC: use
+                  volatile reads or _ReadWriteBarrier).
+
+  Usage:
+    const auto result = microbench::run("isqrt64", [&] {
+      microbench::DoNotOptimize(isqrt64(value));
+    });
+    microbench::printResult(result);
+    microbench::writeCsvHeader(stdout);
+    microbench::writeCsvRow(stdout, result);
+*/
+
+#ifndef MICRO_BENCHMARK_HPP
+#define MICRO_BENCHMARK_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace microbench {
+
+/// Prevents the compiler from optimizing away a computed value.
+template <typename T>
+inline void DoNotOptimize(T const &value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "g"(value) : "memory");
+#else
+  volatile const T *sink = &value;
+  (void)sink;
+#endif
+}
+
+/// Forces pending writes to be considered observable (pairs with DoNotOptimize).
+inline void ClobberMemory() {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : : "memory");
+#endif
+}
+
+struct Options {
+  uint64_t minSampleTimeNs = 1'000'000; // calibrate until one sample takes >= 1 ms
+  int samples = 31;                     // odd count keeps the median exact
+};
+
+struct Result {
+  const char *name;
+  uint64_t iterationsPerSample;
+  int samples;
+  double minNsPerOp;
+  double medianNsPerOp;
+  double p99NsPerOp;
+  double meanNsPerOp;
+  double stddevNsPerOp;
+};
+
+namespace detail {
+
+inline uint64_t nowNs() {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+template <typename F>
+uint64_t timeBatchNs(F &&fn, uint64_t iterations) {
+  const uint64_t start = nowNs();
+  for (uint64_t i = 0; i < iterations; ++i) {
+    fn();
+  }
+  ClobberMemory();
+  return nowNs() - start;
+}
+
+} // namespace detail
+
+/// Runs fn repeatedly, calibrating the per-sample iteration count first.
+template <typename F>
+Result run(const char *name, F &&fn, const Options &options = Options{}) {
+  // Calibration: double the batch size until one batch meets the time budget.
+  uint64_t iterations = 1;
+  while (detail::timeBatchNs(fn, iterations) < options.minSampleTimeNs) {
+    iterations *= 2;
+  }
+
+  std::vector<double> nsPerOp;
+  nsPerOp.reserve(static_cast<size_t>(options.samples));
+  for (int s = 0; s < options.samples; ++s) {
+    const uint64_t elapsed = detail::timeBatchNs(fn, iterations);
+    nsPerOp.push_back(static_cast<double>(elapsed) / static_cast<double>(iterations));
+  }
+  std::sort(nsPerOp.begin(), nsPerOp.end());
+
+  double sum = 0.0;
+  for (double v : nsPerOp) {
+    sum += v;
+  }
+  const double mean = sum / static_cast<double>(nsPerOp.size());
+  double varSum = 0.0;
+  for (double v : nsPerOp) {
+    varSum += (v - mean) * (v - mean);
+  }
+
+  Result result{};
+  result.name = name;
+  result.iterationsPerSample = iterations;
+  result.samples = options.samples;
+  result.minNsPerOp = nsPerOp.front();
+  result.medianNsPerOp = nsPerOp[nsPerOp.size() / 2];
+  result.p99NsPerOp = nsPerOp[(nsPerOp.size() * 99) / 100];
+  result.meanNsPerOp = mean;
+  result.stddevNsPerOp = std::sqrt(varSum / static_cast<double>(nsPerOp.size()));
+  return result;
+}
+
+inline void printResult(const Result &r) {
+  std::printf("%-24s med %10.2f ns/op  p99 %10.2f  min %10.2f  sd %8.2f  (%d x %llu iters)\n",
+              r.name, r.medianNsPerOp, r.p99NsPerOp, r.minNsPerOp, r.stddevNsPerOp, r.samples,
+              static_cast<unsigned long long>(r.iterationsPerSample));
+}
+
+inline void writeCsvHeader(std::FILE *out) {
+  std::fprintf(out, "name,iterations,samples,min_ns,median_ns,p99_ns,mean_ns,stddev_ns\n");
+}
+
+inline void writeCsvRow(std::FILE *out, const Result &r) {
+  std::fprintf(out, "%s,%llu,%d,%.3f,%.3f,%.3f,%.3f,%.3f\n", r.name,
+               static_cast<unsigned long long>(r.iterationsPerSample), r.samples,
+               r.minNsPerOp, r.medianNsPerOp, r.p99NsPerOp, r.meanNsPerOp, r.stddevNsPerOp);
+}
+
+} // namespace microbench
+
+#endif // MICRO_BENCHMARK_HPP
+
+/*
+  Demo build:
+    g++ -std=c++17 -O2 -DMICRO_BENCHMARK_DEMO -x c++ MicroBenchmark.hpp -o microbench_demo
+*/
+#ifdef MICRO_BENCHMARK_DEMO
+#include <cmath>
+
+int main() {
+  volatile double x = 1.2345;
+
+  const auto sqrtResult = microbench::run("std::sqrt", [&] {
+    microbench::DoNotOptimize(std::sqrt(x));
+  });
+  const auto mulResult = microbench::run("double multiply", [&] {
+    microbench::DoNotOptimize(x * x);
+  });
+
+  microbench::printResult(sqrtResult);
+  microbench::printResult(mulResult);
+
+  microbench::writeCsvHeader(stdout);
+  microbench::writeCsvRow(stdout, sqrtResult);
+  microbench::writeCsvRow(stdout, mulResult);
+  return 0;
+}
+#endif // MICRO_BENCHMARK_DEMO
@@ -0,0 +1,187 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        Cpp/Checksum
+FILE:             Crc.hpp
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  CRC Snippet (constexpr tables + hardware path)
+  Integrity checks for serial captures and binary log frames. The lookup tables are
+  generated at compile time (zero startup cost, flash-resident on AVR), and the
+  Castagnoli variant switches to the dedicated CRC instruction on SSE4.2/ARMv8 hosts,
+  which validates capture files at many GB/s instead of the ~300 MB/s of a byte-wise
+  table walk.
+
+  Provided:
+    - crc16Ccitt(): CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF) — frame checksums
+      small enough for AVR binary log records.
+    - crc32Ieee(): reflected CRC-32 (poly 0xEDB88320) — matches zlib/zip/png.
+    - crc32c():    CRC-32C/Castagnoli (poly 0x1EDC6F41) — hardware-accelerated where
+                   available, table fallback elsewhere. Use this for new formats.
+
+  Complexity:     1 table lookup per byte (software), 8 bytes per instruction (hardware).
+  Requirements:   C++17. Hardware path auto-selected under __SSE4_2__ or
+                  __ARM_FEATURE_CRC32 (compile with -msse4.2 / -march=armv8-a+crc).
+
+  Usage:
+    const uint32_t checksum = crc::crc32c(frame, frameSize);
+    static_assert(crc::crc16Ccitt(kId, sizeof(kId)) == 0x29B1); // fully constexpr
+*/
+
+#ifndef CRC_HPP
+#define CRC_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+
+#if defined(__SSE4_2__)
+#include <nmmintrin.h>
+#define CRC_HW_SSE42 1
+#elif defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#define CRC_HW_ARM 1
+#endif
+
+namespace crc {
+
+namespace detail {
+
+constexpr std::array<uint16_t, 256> makeCrc16Table() {
+  std::array<uint16_t, 256> table{};
+  for (uint32_t i = 0; i < 256; ++i) {
+    uint16_t value = static_cast<uint16_t>(i << 8);
+    for (int bit = 0; bit < 8; ++bit) {
+      value = static_cast<uint16_t>((value & 0x8000) ? (value << 1) ^ 0x1021
+                                                     : (value << 1));
+    }
+    table[i] = value;
+  }
+  return table;
+}
+
+constexpr std::array<uint32_t, 256> makeReflectedCrc32Table(uint32_t polynomial) {
+  std::array<uint32_t, 256> table{};
+  for (uint32_t i = 0; i < 256; ++i) {
+    uint32_t value = i;
+    for (int bit = 0; bit < 8; ++bit) {
+      value = (value & 1) ? (value >> 1) ^ polynomial : (value >> 1);
+    }
+    table[i] = value;
+  }
+  return table;
+}
+
+inline constexpr std::array<uint16_t, 256> kCrc16Table = makeCrc16Table();
+inline constexpr std::array<uint32_t, 256> kCrc32IeeeTable =
+    makeReflectedCrc32Table(0xEDB88320u);
+inline constexpr std::array<uint32_t, 256> kCrc32cTable =
+    makeReflectedCrc32Table(0x82F63B78u);
+
+} // namespace detail
+
+/// CRC-16/CCITT-FALSE. crc16Ccitt("123456789") == 0x29B1.
+constexpr uint16_t crc16Ccitt(const uint8_t *data, size_t length,
+                              uint16_t seed = 0xFFFF) {
+  uint16_t value = seed;
+  for (size_t i = 0; i < length; ++i) {
+    value = static_cast<uint16_t>((value << 8) ^
+                                  detail::kCrc16Table[(value >> 8) ^ data[i]]);
+  }
+  return value;
+}
+
+/// Reflected CRC-32 (IEEE/zlib). crc32Ieee("123456789") == 0xCBF43926.
+constexpr uint32_t crc32Ieee(const uint8_t *data, size_t length,
+                             uint32_t seed = 0xFFFFFFFFu) {
+  uint32_t value = seed;
+  for (size_t i = 0; i < length; ++i) {
+    value = (value >> 8) ^ detail::kCrc32IeeeTable[(value ^ data[i]) & 0xFF];
+  }
+  return value ^ 0xFFFFFFFFu;
+}
+
+/// Software CRC-32C (Castagnoli), constexpr for compile-time IDs.
+constexpr uint32_t crc32cSoftware(const uint8_t *data, size_t length,
+                                  uint32_t seed = 0xFFFFFFFFu) {
+  uint32_t value = seed;
+  for (size_t i = 0; i < length; ++i) {
+    value = (value >> 8) ^ detail::kCrc32cTable[(value ^ data[i]) & 0xFF];
+  }
+  return value ^ 0xFFFFFFFFu;
+}
+
+/// CRC-32C with the hardware instruction where available (same polynomial the
+/// SSE4.2 crc32 and ARMv8 CRC32C instructions implement). crc32c("123456789")
+/// == 0xE3069283 on every path.
+inline uint32_t crc32c(const uint8_t *data, size_t length,
+                       uint32_t seed = 0xFFFFFFFFu) {
+#if defined(CRC_HW_SSE42)
+  uint64_t value = seed;
+  size_t i = 0;
+  for (; i + 8 <= length; i += 8) {
+    uint64_t chunk;
+    __builtin_memcpy(&chunk, data + i, 8);
+    value = _mm_crc32_u64(value, chunk);
+  }
+  uint32_t tail = static_cast<uint32_t>(value);
+  for (; i < length; ++i) {
+    tail = _mm_crc32_u8(tail, data[i]);
+  }
+  return tail ^ 0xFFFFFFFFu;
+#elif defined(CRC_HW_ARM)
+  uint32_t value = seed;
+  size_t i = 0;
+  for (; i + 8 <= length; i += 8) {
+    uint64_t chunk;
+    __builtin_memcpy(&chunk, data + i, 8);
+    value = __crc32cd(value, chunk);
+  }
+  for (; i < length; ++i) {
+    value = __crc32cb(value, data[i]);
+  }
+  return value ^ 0xFFFFFFFFu;
+#else
+  return crc32cSoftware(data, length, seed);
+#endif
+}
+
+} // namespace crc
+
+#endif // CRC_HPP
+
+/*
+  Demo build:
+    g++ -std=c++17 -O2 -msse4.2 -DCRC_DEMO -x c++ Crc.hpp -o crc_demo
+*/
+#ifdef CRC_DEMO
+#include <cstdio>
+#include <cstring>
+
+int main() {
+  const char *check = "123456789";
+  const uint8_t *data = reinterpret_cast<const uint8_t *>(check);
+  const size_t length = std::strlen(check);
+
+  const uint16_t c16 = crc::crc16Ccitt(data, length);
+  const uint32_t c32 = crc::crc32Ieee(data, length);
+  const uint32_t c32cSw = crc::crc32cSoftware(data, length);
+  const uint32_t c32cHw = crc::crc32c(data, length);
+
+  std::printf("CRC-16/CCITT: 0x%04X (expect 0x29B1)\n", c16);
+  std::printf("CRC-32:       0x%08X (expect 0xCBF43926)\n", c32);
+  std::printf("CRC-32C sw:   0x%08X (expect 0xE3069283)\n", c32cSw);
+  std::printf("CRC-32C:      0x%08X (hardware path where compiled in)\n", c32cHw);
+
+  const bool ok =
+      c16 == 0x29B1 && c32 == 0xCBF43926u && c32cSw == 0xE3069283u && c32cHw == c32cSw;
+  std::printf(ok ? "All check values match.\n" : "CRC mismatch!\n");
+  return ok ? 0 : 1;
+}
+#endif // CRC_DEMO
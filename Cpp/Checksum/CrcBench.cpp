@@ -0,0 +1,58 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        Cpp/Checksum
+FILE:             CrcBench.cpp
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  CRC Throughput Benchmark
+  Compares the byte-wise table walk against the hardware CRC-32C path on a 64 MiB
+  buffer — the capture-file validation scenario.
+
+  Usage:
+    g++ -std=c++17 -O2 -msse4.2 CrcBench.cpp -o crc_bench
+    ./crc_bench [--csv]
+*/
+
+#include <cstring>
+#include <vector>
+
+#include "../Benchmark/MicroBenchmark.hpp"
+#include "Crc.hpp"
+
+int main(int argc, char **argv) {
+  const bool csv = argc > 1 && std::strcmp(argv[1], "--csv") == 0;
+
+  std::vector<uint8_t> buffer(64u << 20);
+  for (size_t i = 0; i < buffer.size(); ++i) {
+    buffer[i] = static_cast<uint8_t>(i * 2654435761u >> 24);
+  }
+
+  const microbench::Options opts{/*minSampleTimeNs=*/50'000'000, /*samples=*/7};
+  const auto tableResult = microbench::run(
+      "crc32c table walk",
+      [&] { microbench::DoNotOptimize(crc::crc32cSoftware(buffer.data(), buffer.size())); },
+      opts);
+  const auto hwResult = microbench::run(
+      "crc32c (hw if built)",
+      [&] { microbench::DoNotOptimize(crc::crc32c(buffer.data(), buffer.size())); },
+      opts);
+
+  if (csv) {
+    microbench::writeCsvHeader(stdout);
+    microbench::writeCsvRow(stdout, tableResult);
+    microbench::writeCsvRow(stdout, hwResult);
+  } else {
+    microbench::printResult(tableResult);
+    microbench::printResult(hwResult);
+    const double bytes = static_cast<double>(buffer.size());
+    std::printf("table: %.2f GB/s | crc32c: %.2f GB/s\n",
+                bytes / tableResult.medianNsPerOp, bytes / hwResult.medianNsPerOp);
+  }
+  return 0;
+}
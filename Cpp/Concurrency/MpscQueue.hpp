@@ -0,0 +1,193 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        Cpp/Concurrency
+FILE:             MpscQueue.hpp
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  Lock-Free Bounded MPSC Queue Snippet
+  Many producers, one consumer: the host-tool counterpart of SpscRingBuffer.hpp for the
+  "worker threads emit records toward one writer thread" shape (serial capture tool,
+  parallel index builder). Producers claim a slot ticket with a single CAS on the tail
+  counter, then publish by storing the slot's sequence number (Vyukov's bounded-queue
+  scheme, restricted to one consumer). Each slot sits on its own cache line so two
+  producers finishing adjacent tickets do not false-share.
+
+  The single consumer never needs atomic RMW: it reads slots in ticket order, waiting
+  only on each slot's sequence, and popBatch() drains everything currently published
+  in one call — the batched drain a writer thread wants before issuing one write().
+
+  Complexity:     push: 1 CAS + 1 release store; pop: 1 acquire load + 1 release store.
+  Memory:         Capacity rounded up to a power of two; one cache line per slot.
+  Requirements:   C++17, <atomic>. T must be movable. One consumer thread only.
+
+  Usage:
+    MpscQueue<LogRecord, 1024> queue;
+    // any thread:
+    while (!queue.push(record)) { std::this_thread::yield(); }
+    // writer thread:
+    LogRecord batch[64];
+    const size_t n = queue.popBatch(batch, 64);
+*/
+
+#ifndef MPSC_QUEUE_HPP
+#define MPSC_QUEUE_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <utility>
+
+template <typename T, size_t Capacity>
+class MpscQueue {
+  static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+  static_assert(Capacity >= 2, "Capacity must be at least 2");
+
+ public:
+  MpscQueue() {
+    for (size_t i = 0; i < Capacity; ++i) {
+      slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  MpscQueue(const MpscQueue &) = delete;
+  MpscQueue &operator=(const MpscQueue &) = delete;
+
+  /// Producer side, any thread. Returns false when the queue is full.
+  bool push(T value) {
+    size_t ticket = tail_.load(std::memory_order_relaxed);
+    for (;;) {
+      Slot &slot = slots_[ticket & kMask];
+      const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+      const intptr_t delta =
+          static_cast<intptr_t>(sequence) - static_cast<intptr_t>(ticket);
+      if (delta == 0) {
+        // Slot is free for this ticket: claim it with one CAS.
+        if (tail_.compare_exchange_weak(ticket, ticket + 1,
+                                        std::memory_order_relaxed)) {
+          slot.value = std::move(value);
+          slot.sequence.store(ticket + 1, std::memory_order_release);
+          return true;
+        }
+        // CAS lost: `ticket` was reloaded, retry with the new value.
+      } else if (delta < 0) {
+        // Slot still holds an unconsumed element from one lap ago: full.
+        return false;
+      } else {
+        // Another producer already took this ticket; chase the tail.
+        ticket = tail_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /// Consumer side, single thread. Returns false when the queue is empty.
+  bool pop(T &out) {
+    Slot &slot = slots_[head_ & kMask];
+    const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+    if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(head_ + 1) < 0) {
+      return false; // producer claimed but not yet published, or truly empty
+    }
+    out = std::move(slot.value);
+    // Mark the slot reusable one lap later.
+    slot.sequence.store(head_ + Capacity, std::memory_order_release);
+    ++head_;
+    return true;
+  }
+
+  /// Drains up to maxCount currently-published elements; returns how many were
+  /// written to `out`. One call per writer wakeup amortizes the acquire fences.
+  size_t popBatch(T *out, size_t maxCount) {
+    size_t drained = 0;
+    while (drained < maxCount && pop(out[drained])) {
+      ++drained;
+    }
+    return drained;
+  }
+
+  /// Approximate (racy) count — producers may be mid-publish.
+  size_t sizeApprox() const {
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    return tail - head_;
+  }
+
+  bool emptyApprox() const { return sizeApprox() == 0; }
+
+  static constexpr size_t capacity() { return Capacity; }
+
+ private:
+  static constexpr size_t kMask = Capacity - 1;
+  static constexpr size_t kCacheLine = 64;
+
+  // One cache line per slot: adjacent tickets land on different lines, so two
+  // producers publishing back-to-back never invalidate each other.
+  struct alignas(kCacheLine) Slot {
+    std::atomic<size_t> sequence;
+    T value;
+  };
+
+  Slot slots_[Capacity];
+  alignas(kCacheLine) std::atomic<size_t> tail_{0}; // producers (ticket counter)
+  alignas(kCacheLine) size_t head_{0};              // consumer only
+};
+
+#endif // MPSC_QUEUE_HPP
+
+/*
+  Demo build:
+    g++ -std=c++17 -O2 -pthread -DMPSC_QUEUE_DEMO -x c++ MpscQueue.hpp -o mpsc_demo
+*/
+#ifdef MPSC_QUEUE_DEMO
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+int main() {
+  constexpr int kProducers = 4;
+  constexpr uint64_t kPerProducer = 100000;
+
+  MpscQueue<uint64_t, 1024> queue;
+  std::atomic<int> producersDone{0};
+
+  std::vector<std::thread> producers;
+  for (int p = 0; p < kProducers; ++p) {
+    producers.emplace_back([&queue, &producersDone, p] {
+      for (uint64_t i = 0; i < kPerProducer; ++i) {
+        while (!queue.push(static_cast<uint64_t>(p) * kPerProducer + i)) {
+          std::this_thread::yield();
+        }
+      }
+      producersDone.fetch_add(1, std::memory_order_release);
+    });
+  }
+
+  uint64_t sum = 0;
+  uint64_t received = 0;
+  uint64_t batch[64];
+  while (received < kProducers * kPerProducer) {
+    const size_t n = queue.popBatch(batch, 64);
+    for (size_t i = 0; i < n; ++i) {
+      sum += batch[i];
+    }
+    received += n;
+    if (n == 0 && producersDone.load(std::memory_order_acquire) < kProducers) {
+      std::this_thread::yield();
+    }
+  }
+  for (auto &t : producers) {
+    t.join();
+  }
+
+  const uint64_t total = kProducers * kPerProducer;
+  const uint64_t expected = total * (total - 1) / 2; // each value 0..total-1 once
+  std::printf("received=%llu sum=%llu expected=%llu -> %s\n",
+              (unsigned long long)received, (unsigned long long)sum,
+              (unsigned long long)expected, sum == expected ? "OK" : "FAILED");
+  return sum == expected ? 0 : 1;
+}
+#endif // MPSC_QUEUE_DEMO
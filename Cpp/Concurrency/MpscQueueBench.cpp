@@ -0,0 +1,116 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        Cpp/Concurrency
+FILE:             MpscQueueBench.cpp
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  MPSC Queue Throughput Benchmark
+  Two measurements: the uncontended push+pop round trip on the harness (cost floor of
+  the CAS/publish protocol), then end-to-end throughput with N producer threads against
+  one batching consumer — the multi-producer logging scenario.
+
+  Usage:
+    g++ -std=c++17 -O2 -pthread MpscQueueBench.cpp -o mpsc_bench
+    ./mpsc_bench [producers] [--csv]
+*/
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "../Benchmark/MicroBenchmark.hpp"
+#include "MpscQueue.hpp"
+
+namespace {
+
+double threadedMopsPerSec(int producerCount, uint64_t perProducer) {
+  MpscQueue<uint64_t, 4096> queue;
+  std::atomic<bool> start{false};
+  std::atomic<int> done{0};
+
+  std::vector<std::thread> producers;
+  for (int p = 0; p < producerCount; ++p) {
+    producers.emplace_back([&, p] {
+      while (!start.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+      }
+      for (uint64_t i = 0; i < perProducer; ++i) {
+        while (!queue.push(static_cast<uint64_t>(p) ^ i)) {
+          std::this_thread::yield();
+        }
+      }
+      done.fetch_add(1, std::memory_order_release);
+    });
+  }
+
+  const uint64_t total = static_cast<uint64_t>(producerCount) * perProducer;
+  uint64_t received = 0;
+  uint64_t batch[128];
+  uint64_t sink = 0;
+
+  const auto begin = std::chrono::steady_clock::now();
+  start.store(true, std::memory_order_release);
+  while (received < total) {
+    const size_t n = queue.popBatch(batch, 128);
+    for (size_t i = 0; i < n; ++i) {
+      sink += batch[i];
+    }
+    received += n;
+    if (n == 0 && done.load(std::memory_order_acquire) < producerCount) {
+      std::this_thread::yield();
+    }
+  }
+  const auto end = std::chrono::steady_clock::now();
+  microbench::DoNotOptimize(sink);
+
+  for (auto &t : producers) {
+    t.join();
+  }
+  const double seconds = std::chrono::duration<double>(end - begin).count();
+  return static_cast<double>(total) / seconds / 1e6;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  int producerCount = 4;
+  bool csv = false;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--csv") == 0) {
+      csv = true;
+    } else {
+      producerCount = std::atoi(argv[i]);
+    }
+  }
+
+  // Cost floor: one thread alternating push/pop, no contention.
+  MpscQueue<uint64_t, 4096> queue;
+  uint64_t counter = 0;
+  const auto uncontended = microbench::run("mpsc push+pop", [&] {
+    queue.push(counter++);
+    uint64_t value = 0;
+    queue.pop(value);
+    microbench::DoNotOptimize(value);
+  });
+
+  const double mops = threadedMopsPerSec(producerCount, 2'000'000);
+
+  if (csv) {
+    microbench::writeCsvHeader(stdout);
+    microbench::writeCsvRow(stdout, uncontended);
+  } else {
+    microbench::printResult(uncontended);
+  }
+  std::printf("%d producers -> 1 consumer: %.1f Mops/s (hw threads: %u)\n",
+              producerCount, mops, std::thread::hardware_concurrency());
+  return 0;
+}
@@ -0,0 +1,339 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        Cpp/Containers
+FILE:             SoaVector.hpp
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  Generic Structure-of-Arrays Vector Snippet
+  The general tool behind Vector3Block: SoaVector<Ts...> stores one contiguous column
+  per field instead of an array of structs, so a kernel that touches only one field
+  streams pure payload instead of dragging the whole record through the cache. Analysis
+  records (timestamp + three axes + status flags) waste half of every cache line in AoS
+  layout; here each column is dense and 64-byte aligned, ready for the SIMD kernels in
+  Vector3Block.hpp/CsvParser.hpp.
+
+  Record-at-a-time ergonomics are kept through a proxy reference: operator[] and the
+  iterator yield a tuple of references into all columns, so structured bindings read
+  like AoS code (`auto [t, x, flags] = records[i]`). All columns live in ONE heap block
+  — growth is a single allocation carved into aligned column regions, not one
+  allocation per field.
+
+  Complexity:     element access O(1); pushBack amortized O(1); growth O(n) moves
+                  with exactly one allocation for all columns.
+  Memory:         sum of column sizes + alignment padding; golden-ratio-ish 2x growth.
+  Requirements:   C++17. Column types must be move-constructible.
+
+  Usage:
+    SoaVector<uint64_t, float, float, float, uint8_t> records;
+    records.pushBack(timestampUs, x, y, z, status);
+    auto xs = records.column<1>();            // contiguous float span, SIMD-ready
+    for (auto [t, x, y, z, s] : records) ...  // AoS-style iteration
+*/
+
+#ifndef SOA_VECTOR_HPP
+#define SOA_VECTOR_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <new>
+#include <tuple>
+#include <utility>
+
+/// Minimal contiguous view (the repo is C++17, one step short of std::span).
+template <typename T>
+class SoaSpan {
+ public:
+  SoaSpan(T *data, size_t size) : data_(data), size_(size) {}
+
+  T *begin() const { return data_; }
+  T *end() const { return data_ + size_; }
+  T *data() const { return data_; }
+  size_t size() const { return size_; }
+  T &operator[](size_t i) const { return data_[i]; }
+
+ private:
+  T *data_;
+  size_t size_;
+};
+
+template <typename... Ts>
+class SoaVector {
+  static_assert(sizeof...(Ts) >= 1, "SoaVector needs at least one column");
+
+ public:
+  static constexpr size_t kColumns = sizeof...(Ts);
+  /// Columns are aligned for aligned SIMD loads and to keep two columns from
+  /// sharing a cache line at their boundary.
+  static constexpr size_t kColumnAlign = 64;
+
+  SoaVector() = default;
+
+  SoaVector(SoaVector &&other) noexcept { swap(other); }
+
+  SoaVector &operator=(SoaVector &&other) noexcept {
+    if (this != &other) {
+      destroyAll();
+      release();
+      swap(other);
+    }
+    return *this;
+  }
+
+  SoaVector(const SoaVector &) = delete;
+  SoaVector &operator=(const SoaVector &) = delete;
+
+  ~SoaVector() {
+    destroyAll();
+    release();
+  }
+
+  size_t size() const { return size_; }
+  size_t capacity() const { return capacity_; }
+  bool empty() const { return size_ == 0; }
+
+  void reserve(size_t newCapacity) {
+    if (newCapacity > capacity_) {
+      reallocate(newCapacity);
+    }
+  }
+
+  /// Appends one record, one value per column.
+  void pushBack(Ts... values) {
+    if (size_ == capacity_) {
+      reallocate(capacity_ == 0 ? 16 : capacity_ * 2);
+    }
+    constructAt(size_, std::move(values)...);
+    ++size_;
+  }
+
+  void popBack() {
+    --size_;
+    destroyAt(size_, std::index_sequence_for<Ts...>{});
+  }
+
+  void clear() {
+    destroyAll();
+    size_ = 0;
+  }
+
+  /// Raw pointer to column I — dense, 64-byte aligned, size() elements.
+  template <size_t I>
+  auto *columnData() {
+    return std::get<I>(columns_);
+  }
+
+  template <size_t I>
+  const auto *columnData() const {
+    return std::get<I>(columns_);
+  }
+
+  /// Column I as an iterable span for SIMD kernels and range-for.
+  template <size_t I>
+  auto column() {
+    return SoaSpan<std::tuple_element_t<I, std::tuple<Ts...>>>(
+        std::get<I>(columns_), size_);
+  }
+
+  template <size_t I>
+  auto column() const {
+    return SoaSpan<const std::tuple_element_t<I, std::tuple<Ts...>>>(
+        std::get<I>(columns_), size_);
+  }
+
+  /// Proxy record: a tuple of references into every column at one index, so
+  /// structured bindings give AoS-style field access over SoA storage.
+  std::tuple<Ts &...> operator[](size_t i) {
+    return rowAt(i, std::index_sequence_for<Ts...>{});
+  }
+
+  std::tuple<const Ts &...> operator[](size_t i) const {
+    return rowAt(i, std::index_sequence_for<Ts...>{});
+  }
+
+  class Iterator {
+   public:
+    Iterator(SoaVector *owner, size_t index) : owner_(owner), index_(index) {}
+
+    std::tuple<Ts &...> operator*() const { return (*owner_)[index_]; }
+    Iterator &operator++() {
+      ++index_;
+      return *this;
+    }
+    bool operator!=(const Iterator &other) const { return index_ != other.index_; }
+    bool operator==(const Iterator &other) const { return index_ == other.index_; }
+
+   private:
+    SoaVector *owner_;
+    size_t index_;
+  };
+
+  Iterator begin() { return Iterator(this, 0); }
+  Iterator end() { return Iterator(this, size_); }
+
+  void swap(SoaVector &other) noexcept {
+    std::swap(storage_, other.storage_);
+    std::swap(columns_, other.columns_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+  }
+
+ private:
+  template <size_t... Is>
+  std::tuple<Ts &...> rowAt(size_t i, std::index_sequence<Is...>) {
+    return std::tie(std::get<Is>(columns_)[i]...);
+  }
+
+  template <size_t... Is>
+  std::tuple<const Ts &...> rowAt(size_t i, std::index_sequence<Is...>) const {
+    return std::tie(std::get<Is>(columns_)[i]...);
+  }
+
+  static size_t alignUp(size_t value) {
+    return (value + kColumnAlign - 1) & ~(kColumnAlign - 1);
+  }
+
+  /// Total bytes for one block holding every column at `capacity` elements.
+  static size_t blockBytes(size_t capacity) {
+    size_t total = 0;
+    ((total = alignUp(total) + sizeof(Ts) * capacity), ...);
+    return alignUp(total);
+  }
+
+  /// Carves a raw block into aligned column start pointers.
+  static std::tuple<Ts *...> carve(unsigned char *block, size_t capacity) {
+    size_t offset = 0;
+    auto next = [&](auto *tag) {
+      using T = std::remove_pointer_t<decltype(tag)>;
+      offset = alignUp(offset);
+      T *column = reinterpret_cast<T *>(block + offset);
+      offset += sizeof(T) * capacity;
+      return column;
+    };
+    return std::tuple<Ts *...>{next(static_cast<Ts *>(nullptr))...};
+  }
+
+  void reallocate(size_t newCapacity) {
+    unsigned char *block = static_cast<unsigned char *>(
+        ::operator new(blockBytes(newCapacity), std::align_val_t{kColumnAlign}));
+    std::tuple<Ts *...> newColumns = carve(block, newCapacity);
+    moveColumns(newColumns, std::index_sequence_for<Ts...>{});
+    destroyAll();
+    release();
+    storage_ = block;
+    columns_ = newColumns;
+    capacity_ = newCapacity;
+  }
+
+  template <size_t... Is>
+  void moveColumns(std::tuple<Ts *...> &dest, std::index_sequence<Is...>) {
+    (std::uninitialized_move_n(std::get<Is>(columns_), size_, std::get<Is>(dest)),
+     ...);
+  }
+
+  void constructAt(size_t i, Ts... values) {
+    constructAtImpl(i, std::index_sequence_for<Ts...>{}, std::move(values)...);
+  }
+
+  template <size_t... Is>
+  void constructAtImpl(size_t i, std::index_sequence<Is...>, Ts... values) {
+    ((void)::new (static_cast<void *>(std::get<Is>(columns_) + i))
+         Ts(std::move(values)),
+     ...);
+  }
+
+  template <size_t... Is>
+  void destroyAt(size_t i, std::index_sequence<Is...>) {
+    (std::destroy_at(std::get<Is>(columns_) + i), ...);
+  }
+
+  void destroyAll() {
+    destroyAllImpl(std::index_sequence_for<Ts...>{});
+  }
+
+  template <size_t... Is>
+  void destroyAllImpl(std::index_sequence<Is...>) {
+    (std::destroy_n(std::get<Is>(columns_), size_), ...);
+  }
+
+  void release() {
+    if (storage_ != nullptr) {
+      ::operator delete(storage_, std::align_val_t{kColumnAlign});
+      storage_ = nullptr;
+      columns_ = {};
+      capacity_ = 0;
+    }
+  }
+
+  unsigned char *storage_ = nullptr;
+  std::tuple<Ts *...> columns_{};
+  size_t size_ = 0;
+  size_t capacity_ = 0;
+};
+
+#endif // SOA_VECTOR_HPP
+
+/*
+  Demo build:
+    g++ -std=c++17 -O2 -DSOA_VECTOR_DEMO -x c++ SoaVector.hpp -o soa_demo
+*/
+#ifdef SOA_VECTOR_DEMO
+#include <cstdio>
+#include <string>
+
+int main() {
+  // The analysis record shape: timestamp + three axes + status flags.
+  SoaVector<uint64_t, float, float, float, uint8_t> records;
+  for (uint64_t i = 0; i < 1000; ++i) {
+    records.pushBack(i * 1250, 0.1f * static_cast<float>(i), -1.0f, 9.81f,
+                     static_cast<uint8_t>(i & 1));
+  }
+
+  // Column kernel: touches only the X floats — 4 bytes per record through the
+  // cache instead of the full 24-byte record.
+  double sumX = 0.0;
+  for (float x : records.column<1>()) {
+    sumX += x;
+  }
+  const double expectedX = 0.1 * (999.0 * 1000.0 / 2.0);
+
+  // AoS-style iteration via the proxy reference, including writes through it.
+  uint64_t flagged = 0;
+  for (auto [t, x, y, z, status] : records) {
+    (void)t;
+    (void)x;
+    (void)z;
+    if (status != 0) {
+      y = 0.0f; // writes land in the real column
+      ++flagged;
+    }
+  }
+
+  // Columns are 64-byte aligned and survived several growth reallocations.
+  const bool aligned =
+      (reinterpret_cast<uintptr_t>(records.columnData<0>()) % 64 == 0) &&
+      (reinterpret_cast<uintptr_t>(records.columnData<4>()) % 64 == 0);
+  const auto [t0, x0, y0, z0, s0] = records[1];
+  const bool proxyWrite = y0 == 0.0f && s0 == 1;
+
+  // Non-trivial column types work too (placement new / destroy per element).
+  SoaVector<std::string, int> labeled;
+  labeled.pushBack("accel", 1);
+  labeled.pushBack("gyro", 2);
+  const bool nonTrivial = std::get<0>(labeled[1]) == "gyro";
+
+  const bool ok = sumX > expectedX - 0.5 && sumX < expectedX + 0.5 &&
+                  flagged == 500 && aligned && proxyWrite && nonTrivial;
+  std::printf("sumX=%.1f flagged=%llu aligned=%d\n", sumX,
+              (unsigned long long)flagged, aligned ? 1 : 0);
+  std::printf(ok ? "soa_vector OK\n" : "soa_vector FAILED\n");
+  return ok ? 0 : 1;
+}
+#endif // SOA_VECTOR_DEMO
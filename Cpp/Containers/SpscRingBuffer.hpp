@@ -0,0 +1,168 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        Cpp/Containers
+FILE:             SpscRingBuffer.hpp
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  Lock-Free SPSC Ring Buffer Snippet
+  Fixed-capacity, heap-free single-producer/single-consumer queue for decoupling a fast
+  producer (e.g. the ADXL345 sampling loop or an ISR) from a slow consumer (e.g. Serial
+  output). Capacity must be a power of two so index wrapping is a single bitwise AND.
+
+  Complexity:     O(1) push/pop, no locks, no dynamic allocation.
+  Memory:         sizeof(T) * Capacity + two indices.
+  Requirements:   C++17. Uses std::atomic with relaxed loads on the fast path and
+                  acquire/release ordering only at the commit points. On AVR (no <atomic>)
+                  the indices fall back to volatile uint8_t, which the core reads and
+                  writes atomically, so interrupts stay enabled except inside the caller's
+                  own critical sections.
+
+  Usage (Arduino sketch, ISR producer / loop consumer):
+    SpscRingBuffer<Vector3, 32> samples;
+    void onDataReady() {            // ISR: never blocks on the UART
+      samples.push(readSample());
+    }
+    void loop() {
+      Vector3 v;
+      while (samples.pop(v)) {
+        printAcceleration(v);       // slow path drains at its own pace
+      }
+    }
+*/
+
+#ifndef SPSC_RING_BUFFER_HPP
+#define SPSC_RING_BUFFER_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__AVR__)
+#define SPSC_RING_BUFFER_HAS_ATOMIC 0
+#else
+#define SPSC_RING_BUFFER_HAS_ATOMIC 1
+#include <atomic>
+#endif
+
+template <typename T, size_t Capacity>
+class SpscRingBuffer {
+  static_assert(Capacity >= 2, "Capacity must be at least 2");
+  static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+ public:
+#if SPSC_RING_BUFFER_HAS_ATOMIC
+  using index_type = size_t;
+#else
+  // 8-bit loads/stores are single instructions on AVR, hence naturally atomic.
+  static_assert(Capacity <= 128, "AVR fallback uses uint8_t indices (Capacity <= 128)");
+  using index_type = uint8_t;
+#endif
+
+  SpscRingBuffer() : head_(0), tail_(0) {}
+
+  SpscRingBuffer(const SpscRingBuffer &) = delete;
+  SpscRingBuffer &operator=(const SpscRingBuffer &) = delete;
+
+  /// Producer side. Returns false when the buffer is full (sample dropped).
+  bool push(const T &value) {
+    const index_type head = loadRelaxed(head_);
+    const index_type nextHead = static_cast<index_type>(head + 1);
+    if (static_cast<index_type>(nextHead - loadAcquire(tail_)) > Capacity) {
+      return false;
+    }
+    slots_[head & kMask] = value;
+    storeRelease(head_, nextHead); // commit point: publish the slot
+    return true;
+  }
+
+  /// Consumer side. Returns false when the buffer is empty.
+  bool pop(T &out) {
+    const index_type tail = loadRelaxed(tail_);
+    if (loadAcquire(head_) == tail) {
+      return false;
+    }
+    out = slots_[tail & kMask];
+    storeRelease(tail_, static_cast<index_type>(tail + 1)); // commit point: free the slot
+    return true;
+  }
+
+  /// Snapshot of the number of queued elements (exact only on the calling side).
+  index_type size() const {
+    return static_cast<index_type>(loadAcquire(head_) - loadAcquire(tail_));
+  }
+
+  bool empty() const { return size() == 0; }
+  bool full() const { return size() == Capacity; }
+
+  static constexpr size_t capacity() { return Capacity; }
+
+ private:
+  static constexpr index_type kMask = static_cast<index_type>(Capacity - 1);
+
+#if SPSC_RING_BUFFER_HAS_ATOMIC
+  using counter_type = std::atomic<index_type>;
+
+  static index_type loadRelaxed(const counter_type &c) {
+    return c.load(std::memory_order_relaxed);
+  }
+  static index_type loadAcquire(const counter_type &c) {
+    return c.load(std::memory_order_acquire);
+  }
+  static void storeRelease(counter_type &c, index_type v) {
+    c.store(v, std::memory_order_release);
+  }
+#else
+  using counter_type = volatile index_type;
+
+  static index_type loadRelaxed(const counter_type &c) { return c; }
+  static index_type loadAcquire(const counter_type &c) { return c; }
+  static void storeRelease(counter_type &c, index_type v) { c = v; }
+#endif
+
+  T slots_[Capacity];
+  counter_type head_; // written by the producer only
+  counter_type tail_; // written by the consumer only
+};
+
+#endif // SPSC_RING_BUFFER_HPP
+
+/*
+  Demo build:
+    g++ -std=c++17 -O2 -DSPSC_RING_BUFFER_DEMO -x c++ SpscRingBuffer.hpp -o spsc_demo
+*/
+#ifdef SPSC_RING_BUFFER_DEMO
+#include <cstdio>
+#include <thread>
+
+int main() {
+  SpscRingBuffer<int, 1024> queue;
+  constexpr int kCount = 1000000;
+
+  std::thread producer([&queue] {
+    for (int i = 0; i < kCount;) {
+      if (queue.push(i)) {
+        ++i;
+      }
+    }
+  });
+
+  long long sum = 0;
+  for (int received = 0; received < kCount;) {
+    int value;
+    if (queue.pop(value)) {
+      sum += value;
+      ++received;
+    }
+  }
+  producer.join();
+
+  const long long expected = static_cast<long long>(kCount - 1) * kCount / 2;
+  std::printf("sum=%lld expected=%lld (%s)\n", sum, expected, sum == expected ? "OK" : "FAIL");
+  return sum == expected ? 0 : 1;
+}
+#endif // SPSC_RING_BUFFER_DEMO
@@ -0,0 +1,144 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        Cpp/Containers
+FILE:             StaticFlatMap.hpp
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  Fixed-Capacity Flat Map Snippet
+  Sorted-array associative container built on StaticVector: keys stay ordered in one
+  contiguous block, so lookup is a cache-friendly binary search and iteration touches no
+  pointers. The embedded-friendly alternative to std::map for small, bounded key sets
+  (device registries, address -> handler tables).
+
+  Complexity:     find O(log n); insert/erase O(n) shifts; no allocation ever.
+  Memory:         sizeof(pair<K, V>) * N + one size counter, all in-object.
+  Requirements:   C++17, StaticVector.hpp (same folder).
+
+  Usage (I2C address -> device label):
+    StaticFlatMap<uint8_t, const char *, 8> devices;
+    devices.insert(0x53, "ADXL345");
+    if (const char **name = devices.find(0x53)) { report(*name); }
+*/
+
+#ifndef STATIC_FLAT_MAP_HPP
+#define STATIC_FLAT_MAP_HPP
+
+#include <stddef.h>
+
+#include <utility>
+
+#include "StaticVector.hpp"
+
+template <typename K, typename V, size_t N>
+class StaticFlatMap {
+ public:
+  using value_type = std::pair<K, V>;
+  using iterator = value_type *;
+  using const_iterator = const value_type *;
+
+  /// Inserts or overwrites; returns false only when the map is full.
+  bool insert(const K &key, V value) {
+    const size_t pos = lowerBound(key);
+    if (pos < entries_.size() && entries_[pos].first == key) {
+      entries_[pos].second = std::move(value);
+      return true;
+    }
+    if (entries_.full()) {
+      return false;
+    }
+    entries_.emplace_back(key, std::move(value)); // grow with the new entry at the end...
+    for (size_t i = entries_.size() - 1; i > pos; --i) {
+      std::swap(entries_[i], entries_[i - 1]); // ...then rotate it into sorted position
+    }
+    return true;
+  }
+
+  /// Returns a pointer to the mapped value, or nullptr when absent.
+  V *find(const K &key) {
+    const size_t pos = lowerBound(key);
+    if (pos < entries_.size() && entries_[pos].first == key) {
+      return &entries_[pos].second;
+    }
+    return nullptr;
+  }
+  const V *find(const K &key) const {
+    return const_cast<StaticFlatMap *>(this)->find(key);
+  }
+
+  bool contains(const K &key) const { return find(key) != nullptr; }
+
+  bool erase(const K &key) {
+    const size_t pos = lowerBound(key);
+    if (pos >= entries_.size() || !(entries_[pos].first == key)) {
+      return false;
+    }
+    entries_.erase(entries_.begin() + pos);
+    return true;
+  }
+
+  void clear() { entries_.clear(); }
+
+  size_t size() const { return entries_.size(); }
+  bool empty() const { return entries_.empty(); }
+  bool full() const { return entries_.full(); }
+  static constexpr size_t capacity() { return N; }
+
+  iterator begin() { return entries_.begin(); }
+  iterator end() { return entries_.end(); }
+  const_iterator begin() const { return entries_.begin(); }
+  const_iterator end() const { return entries_.end(); }
+
+ private:
+  /// Index of the first entry whose key is not less than key.
+  size_t lowerBound(const K &key) const {
+    size_t low = 0;
+    size_t high = entries_.size();
+    while (low < high) {
+      const size_t mid = low + (high - low) / 2;
+      if (entries_[mid].first < key) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+    return low;
+  }
+
+  StaticVector<value_type, N> entries_;
+};
+
+#endif // STATIC_FLAT_MAP_HPP
+
+/*
+  Demo build:
+    g++ -std=c++17 -O2 -DSTATIC_FLAT_MAP_DEMO -x c++ StaticFlatMap.hpp -o static_flat_map_demo
+*/
+#ifdef STATIC_FLAT_MAP_DEMO
+#include <cstdint>
+#include <cstdio>
+
+int main() {
+  StaticFlatMap<uint8_t, const char *, 8> devices;
+  devices.insert(0x68, "MPU6050");
+  devices.insert(0x53, "ADXL345");
+  devices.insert(0x3C, "SSD1306");
+  devices.insert(0x53, "ADXL345 (rev B)"); // overwrite keeps the map sorted and sized
+
+  for (const auto &[address, name] : devices) {
+    std::printf("0x%02X -> %s\n", address, name);
+  }
+
+  const char **found = devices.find(0x53);
+  const bool ok = devices.size() == 3 && found != nullptr &&
+                  devices.begin()->first == 0x3C && devices.erase(0x68) &&
+                  !devices.contains(0x68);
+  std::printf(ok ? "StaticFlatMap OK\n" : "StaticFlatMap FAILED\n");
+  return ok ? 0 : 1;
+}
+#endif // STATIC_FLAT_MAP_DEMO
@@ -0,0 +1,134 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        Cpp/Containers
+FILE:             StaticString.hpp
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  Fixed-Capacity String Snippet
+  Heap-free, always NUL-terminated string with in-object storage, fully constexpr
+  construction, and truncating (never overflowing) append operations. Intended for
+  building log lines and device names on AVR/STM32 where std::string is off-limits.
+
+  Complexity:     O(n) append/compare; no allocation ever.
+  Memory:         N + 1 chars + one length counter, all in-object.
+  Requirements:   C++17.
+
+  Usage:
+    constexpr StaticString<32> kPrefix("I2C device 0x");
+    StaticString<32> line = kPrefix;
+    line.appendHex(address);
+*/
+
+#ifndef STATIC_STRING_HPP
+#define STATIC_STRING_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+template <size_t N>
+class StaticString {
+  static_assert(N > 0, "Capacity must be positive");
+
+ public:
+  constexpr StaticString() : data_{}, size_(0) {}
+
+  /// Copies up to N characters from a literal or C string (truncates silently).
+  constexpr StaticString(const char *text) : data_{}, size_(0) { append(text); }
+
+  /// Appends as much of text as fits; returns false when truncated.
+  constexpr bool append(const char *text) {
+    while (*text != '\0') {
+      if (size_ == N) {
+        return false;
+      }
+      data_[size_++] = *text++;
+    }
+    data_[size_] = '\0';
+    return true;
+  }
+
+  constexpr bool push_back(char c) {
+    if (size_ == N) {
+      return false;
+    }
+    data_[size_++] = c;
+    data_[size_] = '\0';
+    return true;
+  }
+
+  /// Appends a byte as two lowercase hex digits (the ScanI2C report format).
+  constexpr bool appendHex(uint8_t value) {
+    constexpr char kDigits[] = "0123456789abcdef";
+    return push_back(kDigits[value >> 4]) && push_back(kDigits[value & 0x0F]);
+  }
+
+  constexpr void clear() {
+    size_ = 0;
+    data_[0] = '\0';
+  }
+
+  constexpr const char *c_str() const { return data_; }
+  constexpr char *data() { return data_; }
+  constexpr size_t size() const { return size_; }
+  constexpr bool empty() const { return size_ == 0; }
+  constexpr bool full() const { return size_ == N; }
+  static constexpr size_t capacity() { return N; }
+
+  constexpr char operator[](size_t index) const { return data_[index]; }
+  constexpr char &operator[](size_t index) { return data_[index]; }
+
+  constexpr const char *begin() const { return data_; }
+  constexpr const char *end() const { return data_ + size_; }
+
+  constexpr bool operator==(const StaticString &other) const {
+    if (size_ != other.size_) {
+      return false;
+    }
+    for (size_t i = 0; i < size_; ++i) {
+      if (data_[i] != other.data_[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+  constexpr bool operator!=(const StaticString &other) const { return !(*this == other); }
+
+ private:
+  char data_[N + 1];
+  size_t size_;
+};
+
+#endif // STATIC_STRING_HPP
+
+/*
+  Demo build:
+    g++ -std=c++17 -O2 -DSTATIC_STRING_DEMO -x c++ StaticString.hpp -o static_string_demo
+*/
+#ifdef STATIC_STRING_DEMO
+#include <cstdio>
+
+int main() {
+  constexpr StaticString<32> kPrefix("I2C device 0x");
+  static_assert(kPrefix.size() == 13, "constexpr construction must work");
+
+  StaticString<32> line = kPrefix;
+  line.appendHex(0x53);
+  line.append(" (ACK)");
+
+  StaticString<8> tiny;
+  const bool truncated = !tiny.append("overflowing text");
+
+  std::printf("%s\n", line.c_str());
+  std::printf("tiny: '%s' (truncated=%d)\n", tiny.c_str(), truncated ? 1 : 0);
+
+  const bool ok = truncated && tiny.full() && line.size() == 21;
+  std::printf(ok ? "StaticString OK\n" : "StaticString FAILED\n");
+  return ok ? 0 : 1;
+}
+#endif // STATIC_STRING_DEMO
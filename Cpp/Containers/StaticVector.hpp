@@ -0,0 +1,205 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        Cpp/Containers
+FILE:             StaticVector.hpp
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  Fixed-Capacity Vector Snippet
+  Drop-in std::vector-like container with in-object storage and no heap, for AVR/STM32
+  firmware (where allocation means fragmentation) and for host code that wants a
+  predictable cache footprint. Elements live in an aligned byte buffer and are
+  constructed in place; when T is trivially destructible, clear() and the destructor
+  compile down to a size reset.
+
+  Complexity:     O(1) push_back/pop_back/back; O(n) erase; no allocation ever.
+  Memory:         sizeof(T) * N + one size counter, all in-object.
+  Requirements:   C++17.
+
+  Usage (buffering I2C scan results, see ScanI2C.ino):
+    StaticVector<uint8_t, 16> found;
+    if (!found.full()) found.push_back(address);
+    for (uint8_t addr : found) { report(addr); }
+*/
+
+#ifndef STATIC_VECTOR_HPP
+#define STATIC_VECTOR_HPP
+
+#include <stddef.h>
+
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template <typename T, size_t N>
+class StaticVector {
+  static_assert(N > 0, "Capacity must be positive");
+
+ public:
+  using value_type = T;
+  using iterator = T *;
+  using const_iterator = const T *;
+
+  StaticVector() : size_(0) {}
+
+  StaticVector(const StaticVector &other) : size_(0) {
+    for (const T &value : other) {
+      push_back(value);
+    }
+  }
+
+  StaticVector(StaticVector &&other) noexcept(
+      std::is_nothrow_move_constructible_v<T>)
+      : size_(0) {
+    for (T &value : other) {
+      emplace_back(std::move(value));
+    }
+    other.clear();
+  }
+
+  StaticVector &operator=(const StaticVector &other) {
+    if (this != &other) {
+      clear();
+      for (const T &value : other) {
+        push_back(value);
+      }
+    }
+    return *this;
+  }
+
+  StaticVector &operator=(StaticVector &&other) noexcept(
+      std::is_nothrow_move_constructible_v<T>) {
+    if (this != &other) {
+      clear();
+      for (T &value : other) {
+        emplace_back(std::move(value));
+      }
+      other.clear();
+    }
+    return *this;
+  }
+
+  ~StaticVector() { clear(); }
+
+  bool push_back(const T &value) {
+    if (full()) {
+      return false;
+    }
+    ::new (slot(size_)) T(value);
+    ++size_;
+    return true;
+  }
+
+  bool push_back(T &&value) {
+    if (full()) {
+      return false;
+    }
+    ::new (slot(size_)) T(std::move(value));
+    ++size_;
+    return true;
+  }
+
+  template <typename... Args>
+  bool emplace_back(Args &&...args) {
+    if (full()) {
+      return false;
+    }
+    ::new (slot(size_)) T(std::forward<Args>(args)...);
+    ++size_;
+    return true;
+  }
+
+  void pop_back() {
+    --size_;
+    destroy(size_);
+  }
+
+  /// Removes the element at pos, shifting the tail left. Returns iterator past it.
+  iterator erase(iterator pos) {
+    for (iterator it = pos; it + 1 != end(); ++it) {
+      *it = std::move(*(it + 1));
+    }
+    pop_back();
+    return pos;
+  }
+
+  void clear() {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      while (size_ > 0) {
+        pop_back();
+      }
+    } else {
+      size_ = 0;
+    }
+  }
+
+  T &operator[](size_t index) { return *slot(index); }
+  const T &operator[](size_t index) const { return *slot(index); }
+  T &front() { return *slot(0); }
+  T &back() { return *slot(size_ - 1); }
+  const T &front() const { return *slot(0); }
+  const T &back() const { return *slot(size_ - 1); }
+
+  T *data() { return slot(0); }
+  const T *data() const { return slot(0); }
+  iterator begin() { return slot(0); }
+  iterator end() { return slot(size_); }
+  const_iterator begin() const { return slot(0); }
+  const_iterator end() const { return slot(size_); }
+
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  bool full() const { return size_ == N; }
+  static constexpr size_t capacity() { return N; }
+
+ private:
+  T *slot(size_t index) {
+    return std::launder(reinterpret_cast<T *>(storage_ + index * sizeof(T)));
+  }
+  const T *slot(size_t index) const {
+    return std::launder(reinterpret_cast<const T *>(storage_ + index * sizeof(T)));
+  }
+
+  void destroy(size_t index) {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      slot(index)->~T();
+    }
+  }
+
+  alignas(T) unsigned char storage_[N * sizeof(T)];
+  size_t size_;
+};
+
+#endif // STATIC_VECTOR_HPP
+
+/*
+  Demo build:
+    g++ -std=c++17 -O2 -DSTATIC_VECTOR_DEMO -x c++ StaticVector.hpp -o static_vector_demo
+*/
+#ifdef STATIC_VECTOR_DEMO
+#include <cstdio>
+#include <string>
+
+int main() {
+  StaticVector<std::string, 4> names;
+  names.push_back("adxl345");
+  names.emplace_back("scanner");
+  names.push_back("scheduler");
+
+  StaticVector<std::string, 4> moved = std::move(names);
+  moved.erase(moved.begin() + 1);
+
+  for (const std::string &name : moved) {
+    std::printf("%s\n", name.c_str());
+  }
+
+  const bool ok = moved.size() == 2 && names.empty() && moved[1] == "scheduler";
+  std::printf(ok ? "StaticVector OK\n" : "StaticVector FAILED\n");
+  return ok ? 0 : 1;
+}
+#endif // STATIC_VECTOR_DEMO
@@ -0,0 +1,239 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        Cpp/DSP
+FILE:             Filters.hpp
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  Compile-Time FIR/IIR Filter Snippet
+  The C++ home for the accelerometer filtering currently done offline in MATLAB: the
+  same taps run in-line on the MCU sample loop or at memory bandwidth on the host over
+  a Vector3Block column.
+
+  Coefficients are compile-time constants. C++17 forbids float non-type template
+  parameters, so the taps travel in a provider type with a `static constexpr` array
+  (see kSmooth5 below); the filter then unrolls the tap loop over an index_sequence,
+  giving the compiler constant multipliers to fold and vectorize.
+
+  Provided:
+    - FirFilter<Coeffs>:       direct-form FIR, delay line in registers when short,
+                               tap loop fully unrolled at compile time.
+    - BiquadCascade<Sections>: IIR as second-order sections (transposed direct form II,
+                               the numerically safe layout for float).
+    - MovingAverage<Window>:   running-sum specialization — O(1) per sample regardless
+                               of window length, the classic accelerometer smoother.
+    - filterColumn():          applies any of the above over a float column, so the
+                               three axes of a Vector3Block filter independently.
+
+  Complexity:     FIR O(taps)/sample (unrolled); biquad O(sections)/sample;
+                  moving average O(1)/sample.
+  Requirements:   C++17, header-only, no allocation — MCU-safe.
+
+  Usage:
+    struct LowPass { static constexpr std::array<float, 5> taps = {...}; };
+    dsp::FirFilter<LowPass> filter;
+    float y = filter.process(x);                  // sample loop
+    dsp::filterColumn(filter, block.x(), block.size()); // whole capture column
+*/
+
+#ifndef DSP_FILTERS_HPP
+#define DSP_FILTERS_HPP
+
+#include <stddef.h>
+
+#include <array>
+#include <utility>
+
+namespace dsp {
+
+/// Direct-form FIR with compile-time taps. Coeffs must expose
+/// `static constexpr std::array<float, N> taps`.
+template <typename Coeffs>
+class FirFilter {
+ public:
+  static constexpr size_t tapCount() { return Coeffs::taps.size(); }
+
+  /// One sample in, one sample out. The tap loop is unrolled over an
+  /// index_sequence so every multiplier is a literal constant.
+  float process(float input) {
+    // Shift the delay line (newest at index 0). For the short kernels used on
+    // sample loops the whole line stays in registers after inlining.
+    for (size_t i = tapCount() - 1; i > 0; --i) {
+      delay_[i] = delay_[i - 1];
+    }
+    delay_[0] = input;
+    return accumulate(std::make_index_sequence<Coeffs::taps.size()>{});
+  }
+
+  /// Filters a column in place — the Vector3Block axis-by-axis path.
+  void processBlock(float *values, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+      values[i] = process(values[i]);
+    }
+  }
+
+  void reset() { delay_ = {}; }
+
+ private:
+  template <size_t... Is>
+  float accumulate(std::index_sequence<Is...>) const {
+    return ((Coeffs::taps[Is] * delay_[Is]) + ...);
+  }
+
+  std::array<float, Coeffs::taps.size()> delay_{};
+};
+
+/// One second-order section: y = b0*x + b1*x1 + b2*x2 - a1*y1 - a2*y2
+/// (a0 normalized to 1, MATLAB `sos` row convention without the a0 column).
+struct BiquadCoeffs {
+  float b0, b1, b2;
+  float a1, a2;
+};
+
+/// IIR filter as a cascade of biquads in transposed direct form II — the layout
+/// that keeps float state bounded where a single high-order direct form blows up.
+template <size_t Sections>
+class BiquadCascade {
+ public:
+  explicit constexpr BiquadCascade(const std::array<BiquadCoeffs, Sections> &sections)
+      : sections_(sections) {}
+
+  float process(float input) {
+    float value = input;
+    for (size_t s = 0; s < Sections; ++s) {
+      const BiquadCoeffs &c = sections_[s];
+      State &st = state_[s];
+      const float output = c.b0 * value + st.z1;
+      st.z1 = c.b1 * value - c.a1 * output + st.z2;
+      st.z2 = c.b2 * value - c.a2 * output;
+      value = output;
+    }
+    return value;
+  }
+
+  void processBlock(float *values, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+      values[i] = process(values[i]);
+    }
+  }
+
+  void reset() { state_ = {}; }
+
+ private:
+  struct State {
+    float z1 = 0.0f;
+    float z2 = 0.0f;
+  };
+
+  std::array<BiquadCoeffs, Sections> sections_;
+  std::array<State, Sections> state_{};
+};
+
+/// Boxcar smoother with the running-sum trick: add the new sample, subtract the
+/// one falling out of the window — O(1) per sample however long the window is.
+template <size_t Window>
+class MovingAverage {
+  static_assert(Window >= 1, "Window must hold at least one sample");
+
+ public:
+  float process(float input) {
+    sum_ += input - window_[index_];
+    window_[index_] = input;
+    index_ = (index_ + 1) % Window;
+    return sum_ * (1.0f / static_cast<float>(Window));
+  }
+
+  void processBlock(float *values, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+      values[i] = process(values[i]);
+    }
+  }
+
+  void reset() {
+    window_ = {};
+    sum_ = 0.0f;
+    index_ = 0;
+  }
+
+ private:
+  std::array<float, Window> window_{};
+  float sum_ = 0.0f;
+  size_t index_ = 0;
+};
+
+/// Runs any filter above over one column (e.g. block.x(), block.size()).
+template <typename Filter>
+inline void filterColumn(Filter &filter, float *values, size_t n) {
+  filter.processBlock(values, n);
+}
+
+/// Ready-made 5-tap boxcar taps, the default ADXL345 capture smoother.
+struct kSmooth5 {
+  static constexpr std::array<float, 5> taps = {0.2f, 0.2f, 0.2f, 0.2f, 0.2f};
+};
+
+} // namespace dsp
+
+#endif // DSP_FILTERS_HPP
+
+/*
+  Demo build:
+    g++ -std=c++17 -O2 -DDSP_FILTERS_DEMO -x c++ Filters.hpp -o filters_demo
+*/
+#ifdef DSP_FILTERS_DEMO
+#include <cmath>
+#include <cstdio>
+
+#include "../DataAnalysis/Vector3Block.hpp"
+
+int main() {
+  // Synthetic capture: slow 2 Hz motion plus fast 120 Hz vibration at 800 Hz rate.
+  Vector3Block block;
+  const size_t kSamples = 4096;
+  block.reserve(kSamples);
+  for (size_t i = 0; i < kSamples; ++i) {
+    const float t = static_cast<float>(i) / 800.0f;
+    const float slow = std::sin(2.0f * 3.14159265f * 2.0f * t);
+    const float fast = 0.5f * std::sin(2.0f * 3.14159265f * 120.0f * t);
+    block.pushBack(slow + fast, slow, fast);
+  }
+
+  const FloatStats before = reduceStats(block.x(), block.size());
+
+  // FIR boxcar on X, running-sum average on Y, a gentle 1-section IIR on Z.
+  dsp::FirFilter<dsp::kSmooth5> fir;
+  dsp::MovingAverage<5> avg;
+  dsp::BiquadCascade<1> iir(std::array<dsp::BiquadCoeffs, 1>{
+      dsp::BiquadCoeffs{0.0675f, 0.1349f, 0.0675f, -1.1430f, 0.4128f}});
+
+  dsp::filterColumn(fir, block.x(), block.size());
+  dsp::filterColumn(avg, block.y(), block.size());
+  dsp::filterColumn(iir, block.z(), block.size());
+
+  const FloatStats after = reduceStats(block.x(), block.size());
+
+  // A 5-tap boxcar at 800 Hz notches near 160 Hz, so the 120 Hz ripple drops hard:
+  // peak amplitude must shrink while the slow component survives.
+  const bool attenuated = after.max < before.max * 0.85f && after.max > 0.8f;
+
+  // FIR boxcar and running-sum moving average are the same filter — outputs match.
+  float maxDiff = 0.0f;
+  dsp::FirFilter<dsp::kSmooth5> firRef;
+  dsp::MovingAverage<5> avgRef;
+  for (size_t i = 0; i < 256; ++i) {
+    const float x = std::sin(0.37f * static_cast<float>(i));
+    maxDiff = std::fmax(maxDiff, std::fabs(firRef.process(x) - avgRef.process(x)));
+  }
+
+  std::printf("X peak %.3f -> %.3f, fir-vs-avg max diff %.2e\n", before.max,
+              after.max, maxDiff);
+  const bool ok = attenuated && maxDiff < 1e-5f;
+  std::printf(ok ? "filters OK\n" : "filters FAILED\n");
+  return ok ? 0 : 1;
+}
+#endif // DSP_FILTERS_DEMO
@@ -0,0 +1,91 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        Cpp/DSP
+FILE:             FiltersBench.cpp
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  Filter Throughput Benchmark
+  Per-sample cost of the three filter shapes over a 1M-sample column — the "filter a
+  whole capture axis on the host" scenario that replaces the MATLAB round trip. The
+  moving average must stay flat as the window grows (running sum), while the FIR cost
+  scales with its unrolled tap count.
+
+  Usage:
+    g++ -std=c++17 -O3 -march=native FiltersBench.cpp -o filters_bench
+    ./filters_bench [--csv]
+*/
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "../Benchmark/MicroBenchmark.hpp"
+#include "Filters.hpp"
+
+namespace {
+
+struct kSmooth15 {
+  static constexpr std::array<float, 15> taps = {
+      1.0f / 15, 1.0f / 15, 1.0f / 15, 1.0f / 15, 1.0f / 15,
+      1.0f / 15, 1.0f / 15, 1.0f / 15, 1.0f / 15, 1.0f / 15,
+      1.0f / 15, 1.0f / 15, 1.0f / 15, 1.0f / 15, 1.0f / 15};
+};
+
+} // namespace
+
+int main(int argc, char **argv) {
+  const bool csv = argc > 1 && std::strcmp(argv[1], "--csv") == 0;
+
+  std::vector<float> input(1u << 20);
+  for (size_t i = 0; i < input.size(); ++i) {
+    input[i] = std::sin(0.013f * static_cast<float>(i));
+  }
+  std::vector<float> work(input.size());
+
+  const microbench::Options opts{/*minSampleTimeNs=*/20'000'000, /*samples=*/11};
+  const auto runFilter = [&](const char *name, auto &filter) {
+    return microbench::run(
+        name,
+        [&] {
+          std::memcpy(work.data(), input.data(), input.size() * sizeof(float));
+          filter.processBlock(work.data(), work.size());
+          microbench::DoNotOptimize(work[work.size() - 1]);
+        },
+        opts);
+  };
+
+  dsp::FirFilter<dsp::kSmooth5> fir5;
+  dsp::FirFilter<kSmooth15> fir15;
+  dsp::MovingAverage<64> avg64;
+  dsp::BiquadCascade<2> iir2(std::array<dsp::BiquadCoeffs, 2>{
+      dsp::BiquadCoeffs{0.0675f, 0.1349f, 0.0675f, -1.1430f, 0.4128f},
+      dsp::BiquadCoeffs{0.0675f, 0.1349f, 0.0675f, -1.0406f, 0.2111f}});
+
+  const auto fir5Result = runFilter("fir 5 taps (1M)", fir5);
+  const auto fir15Result = runFilter("fir 15 taps (1M)", fir15);
+  const auto avgResult = runFilter("moving avg 64 (1M)", avg64);
+  const auto iirResult = runFilter("biquad x2 (1M)", iir2);
+
+  if (csv) {
+    microbench::writeCsvHeader(stdout);
+    microbench::writeCsvRow(stdout, fir5Result);
+    microbench::writeCsvRow(stdout, fir15Result);
+    microbench::writeCsvRow(stdout, avgResult);
+    microbench::writeCsvRow(stdout, iirResult);
+  } else {
+    microbench::printResult(fir5Result);
+    microbench::printResult(fir15Result);
+    microbench::printResult(avgResult);
+    microbench::printResult(iirResult);
+    const double samples = static_cast<double>(input.size());
+    std::printf("moving avg 64: %.2f ns/sample (window-independent)\n",
+                avgResult.medianNsPerOp / samples);
+  }
+  return 0;
+}
@@ -0,0 +1,114 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        Cpp/DataAnalysis
+FILE:             CaptureConvert.cpp
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  Legacy Capture Converter
+  One-time migration path into the framed binary format (CaptureFormat.hpp): reads a
+  line-oriented "timestamp,x,y,z" text capture (what Serial_SaveData.py and the Arduino
+  sketches emit) through the mmap + SIMD CSV pipeline, stamps each record with a CRC and
+  writes a .ncap container. Also doubles as an integrity checker for existing captures.
+
+  Legacy timestamps are taken as seconds and stored as integer microseconds; use
+  --ts-scale when the source already logs in another unit (e.g. 1 for raw us).
+
+  Usage:
+    g++ -std=c++17 -O2 -msse4.2 CaptureConvert.cpp -o capture_convert
+    ./capture_convert capture.txt capture.ncap
+    ./capture_convert capture.txt capture.ncap --ts-scale 1000
+    ./capture_convert --verify capture.ncap
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "CaptureFormat.hpp"
+#include "CsvParser.hpp"
+#include "MmapFile.hpp"
+
+namespace {
+
+int verifyCapture(const char *path) {
+  captureformat::CaptureReader reader;
+  if (!reader.open(path)) {
+    std::fprintf(stderr, "%s: not a valid capture container\n", path);
+    return 1;
+  }
+  const size_t firstBad = reader.verify();
+  if (firstBad != reader.recordCount()) {
+    std::fprintf(stderr, "%s: record %zu of %zu fails its CRC\n", path, firstBad,
+                 reader.recordCount());
+    return 1;
+  }
+  std::printf("%s: %zu records, all CRCs valid\n", path, reader.recordCount());
+  return 0;
+}
+
+int convertCapture(const char *inputPath, const char *outputPath, double tsScale) {
+  MmapFile input;
+  if (!input.open(inputPath)) {
+    std::fprintf(stderr, "Cannot open %s\n", inputPath);
+    return 1;
+  }
+  input.adviseSequential();
+
+  captureformat::CaptureWriter writer;
+  if (!writer.open(outputPath)) {
+    std::fprintf(stderr, "Cannot create %s\n", outputPath);
+    return 1;
+  }
+
+  size_t lines = 0;
+  size_t skipped = 0;
+  csvparse::forEachLine(input.view(), [&](std::string_view line) {
+    ++lines;
+    csvparse::CaptureRow row;
+    if (!csvparse::parseRow(line, row)) {
+      ++skipped; // headers, partial last lines, serial glitches
+      return;
+    }
+    captureformat::CaptureRecord record{};
+    record.timestampUs = static_cast<uint64_t>(row.timestamp * tsScale);
+    record.x = row.x;
+    record.y = row.y;
+    record.z = row.z;
+    record.status = 0;
+    writer.append(record);
+  });
+
+  if (!writer.finalize()) {
+    std::fprintf(stderr, "Error finalizing %s\n", outputPath);
+    return 1;
+  }
+  std::printf("%s: %llu records written (%zu of %zu lines skipped)\n", outputPath,
+              (unsigned long long)writer.recordCount(), skipped, lines);
+  return 0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  if (argc == 3 && std::strcmp(argv[1], "--verify") == 0) {
+    return verifyCapture(argv[2]);
+  }
+
+  double tsScale = 1e6; // legacy captures log seconds
+  if (argc == 5 && std::strcmp(argv[3], "--ts-scale") == 0) {
+    tsScale = std::strtod(argv[4], nullptr);
+  } else if (argc != 3) {
+    std::fprintf(stderr,
+                 "Usage: %s input.txt output.ncap [--ts-scale FACTOR]\n"
+                 "       %s --verify capture.ncap\n",
+                 argv[0], argv[0]);
+    return 2;
+  }
+  return convertCapture(argv[1], argv[2], tsScale);
+}
@@ -0,0 +1,306 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        Cpp/DataAnalysis
+FILE:             CaptureFormat.hpp
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  Framed Binary Capture Format Snippet
+  Zero-copy container shared by the capture and analysis tools: where text captures force
+  the SIMD CSV parse (CsvParser.hpp) on every open, this format stores fixed-size framed
+  records that ARE the in-memory layout. Records start at a 4 KiB segment boundary, so
+  the mmap reader (MmapFile.hpp) hands out a pointer-typed view of the whole capture in
+  microseconds — no parsing, no copying, iteration at memory bandwidth.
+
+  Layout (little-endian, the byte order of every capture host we use):
+    [0, 4096)   FileHeader: magic "NCAP", version, record size/count, header CRC-32C;
+                the rest of the first segment is reserved (zeros).
+    [4096, ...) CaptureRecord x recordCount, 32 bytes each (128 per 4 KiB segment):
+                u64 monotonic timestamp (us), float x/y/z, u8 status flags, padding,
+                and a CRC-32C (Crc.hpp) over the first 28 bytes of the record.
+
+  CaptureWriter appends with CRC stamping and patches the record count on finalize();
+  CaptureReader validates the header and exposes the records as a contiguous view, with
+  an optional full CRC sweep (hardware CRC path: multiple GB/s).
+
+  Complexity:     open O(1); iteration O(records) at memory bandwidth; verify O(bytes).
+  Requirements:   C++17, POSIX mmap (reader); little-endian host. Uses Crc.hpp and
+                  MmapFile.hpp from this repository.
+
+  Usage:
+    captureformat::CaptureWriter writer;
+    writer.open("run.ncap");
+    writer.append({timestampUs, x, y, z, status});
+    writer.finalize();
+
+    captureformat::CaptureReader reader;
+    reader.open("run.ncap");                       // microseconds, any file size
+    for (const auto &record : reader.records()) ...
+*/
+
+#ifndef CAPTURE_FORMAT_HPP
+#define CAPTURE_FORMAT_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <cstdio>
+#include <cstring>
+
+#include "../Checksum/Crc.hpp"
+#include "MmapFile.hpp"
+
+namespace captureformat {
+
+constexpr uint32_t kMagic = 0x5041434Eu; // "NCAP"
+constexpr uint16_t kVersion = 1;
+constexpr size_t kSegmentSize = 4096; // mmap page / typical flash erase unit
+
+/// One 32-byte frame; the on-disk and in-memory layout are the same struct.
+struct CaptureRecord {
+  uint64_t timestampUs; // monotonic, never wall clock (captures span suspends)
+  float x;
+  float y;
+  float z;
+  uint8_t status;
+  uint8_t reserved[3];
+  uint32_t crc; // CRC-32C over the first 28 bytes
+
+  /// Computes the frame checksum (everything before the crc field).
+  uint32_t computeCrc() const {
+    return crc::crc32c(reinterpret_cast<const uint8_t *>(this),
+                       offsetof(CaptureRecord, crc));
+  }
+
+  bool valid() const { return crc == computeCrc(); }
+};
+
+static_assert(sizeof(CaptureRecord) == 32, "records must pack 128 per segment");
+static_assert(kSegmentSize % sizeof(CaptureRecord) == 0,
+              "records must not straddle segment boundaries");
+
+struct FileHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t flags;
+  uint32_t recordSize;
+  uint32_t segmentSize;
+  uint64_t recordCount;
+  uint32_t headerCrc; // CRC-32C over the fields above
+  uint8_t reserved[4];
+
+  uint32_t computeCrc() const {
+    return crc::crc32c(reinterpret_cast<const uint8_t *>(this),
+                       offsetof(FileHeader, headerCrc));
+  }
+};
+
+static_assert(sizeof(FileHeader) == 32, "header layout is part of the format");
+
+/// Contiguous typed view over the mapped records (the repo's C++17 span stand-in).
+class RecordSpan {
+ public:
+  RecordSpan(const CaptureRecord *data, size_t count) : data_(data), count_(count) {}
+
+  const CaptureRecord *begin() const { return data_; }
+  const CaptureRecord *end() const { return data_ + count_; }
+  const CaptureRecord *data() const { return data_; }
+  size_t size() const { return count_; }
+  const CaptureRecord &operator[](size_t i) const { return data_[i]; }
+
+ private:
+  const CaptureRecord *data_;
+  size_t count_;
+};
+
+/// Streams records to disk with CRC stamping; finalize() pads the last segment
+/// and patches the header with the final record count.
+class CaptureWriter {
+ public:
+  ~CaptureWriter() { finalize(); }
+
+  bool open(const char *path) {
+    file_ = std::fopen(path, "wb");
+    if (file_ == nullptr) {
+      return false;
+    }
+    // Reserve the header segment; the real header lands in finalize().
+    uint8_t zeros[kSegmentSize] = {};
+    return std::fwrite(zeros, 1, kSegmentSize, file_) == kSegmentSize;
+  }
+
+  bool append(CaptureRecord record) {
+    record.reserved[0] = record.reserved[1] = record.reserved[2] = 0;
+    record.crc = record.computeCrc();
+    if (std::fwrite(&record, 1, sizeof(record), file_) != sizeof(record)) {
+      return false;
+    }
+    ++recordCount_;
+    return true;
+  }
+
+  bool finalize() {
+    if (file_ == nullptr) {
+      return true;
+    }
+    // Zero-pad so the file ends on a segment boundary (clean mmap tail).
+    const size_t tail =
+        (recordCount_ * sizeof(CaptureRecord)) % kSegmentSize;
+    if (tail != 0) {
+      uint8_t zeros[kSegmentSize] = {};
+      std::fwrite(zeros, 1, kSegmentSize - tail, file_);
+    }
+
+    FileHeader header{};
+    header.magic = kMagic;
+    header.version = kVersion;
+    header.flags = 0;
+    header.recordSize = sizeof(CaptureRecord);
+    header.segmentSize = kSegmentSize;
+    header.recordCount = recordCount_;
+    header.headerCrc = header.computeCrc();
+
+    std::fseek(file_, 0, SEEK_SET);
+    const bool ok =
+        std::fwrite(&header, 1, sizeof(header), file_) == sizeof(header);
+    std::fclose(file_);
+    file_ = nullptr;
+    return ok;
+  }
+
+  uint64_t recordCount() const { return recordCount_; }
+
+ private:
+  std::FILE *file_ = nullptr;
+  uint64_t recordCount_ = 0;
+};
+
+/// Maps a capture and exposes the records without reading a single payload byte
+/// up front — a 10 GB capture opens as fast as a 10 KB one.
+class CaptureReader {
+ public:
+  bool open(const char *path) {
+    if (!file_.open(path)) {
+      return false;
+    }
+    if (file_.size() < kSegmentSize) {
+      file_.close();
+      return false;
+    }
+    const FileHeader *header =
+        reinterpret_cast<const FileHeader *>(file_.view().data());
+    const bool headerOk = header->magic == kMagic && header->version == kVersion &&
+                          header->recordSize == sizeof(CaptureRecord) &&
+                          header->segmentSize == kSegmentSize &&
+                          header->headerCrc == header->computeCrc();
+    const uint64_t payloadBytes = file_.size() - kSegmentSize;
+    if (!headerOk || header->recordCount * sizeof(CaptureRecord) > payloadBytes) {
+      file_.close();
+      return false;
+    }
+    count_ = header->recordCount;
+    return true;
+  }
+
+  void close() { file_.close(); }
+
+  /// Zero-copy view over every record; valid while the reader stays open.
+  RecordSpan records() const {
+    return RecordSpan(reinterpret_cast<const CaptureRecord *>(
+                          file_.view().data() + kSegmentSize),
+                      count_);
+  }
+
+  /// Full CRC sweep (hardware CRC path where compiled in). Returns the index of
+  /// the first corrupt record, or recordCount() when everything checks out.
+  size_t verify() const {
+    const RecordSpan all = records();
+    for (size_t i = 0; i < all.size(); ++i) {
+      if (!all[i].valid()) {
+        return i;
+      }
+    }
+    return all.size();
+  }
+
+  size_t recordCount() const { return count_; }
+
+ private:
+  MmapFile file_;
+  size_t count_ = 0;
+};
+
+} // namespace captureformat
+
+#endif // CAPTURE_FORMAT_HPP
+
+/*
+  Demo build:
+    g++ -std=c++17 -O2 -msse4.2 -DCAPTURE_FORMAT_DEMO -x c++ CaptureFormat.hpp -o capture_demo
+*/
+#ifdef CAPTURE_FORMAT_DEMO
+#include <cstdlib>
+
+int main() {
+  const char *path = "/tmp/capture_format_demo.ncap";
+  const size_t kRecords = 1000; // deliberately not a multiple of 128
+
+  {
+    captureformat::CaptureWriter writer;
+    if (!writer.open(path)) {
+      std::perror("open for write");
+      return 1;
+    }
+    for (size_t i = 0; i < kRecords; ++i) {
+      writer.append({i * 1250, 0.001f * static_cast<float>(i), -1.0f, 9.81f,
+                     static_cast<uint8_t>(i & 3), {}, 0});
+    }
+    writer.finalize();
+  }
+
+  captureformat::CaptureReader reader;
+  if (!reader.open(path)) {
+    std::fprintf(stderr, "reader rejected its own file\n");
+    return 1;
+  }
+
+  double sumX = 0.0;
+  uint64_t lastTimestamp = 0;
+  bool monotonic = true;
+  for (const auto &record : reader.records()) {
+    sumX += record.x;
+    monotonic = monotonic && (lastTimestamp == 0 || record.timestampUs > lastTimestamp);
+    lastTimestamp = record.timestampUs;
+  }
+  const size_t firstBad = reader.verify();
+  reader.close();
+
+  // Flip one payload byte; verify() must name the corrupted record.
+  std::FILE *f = std::fopen(path, "r+b");
+  std::fseek(f, static_cast<long>(captureformat::kSegmentSize +
+                                  42 * sizeof(captureformat::CaptureRecord) + 9),
+             SEEK_SET);
+  std::fputc(0x7F, f);
+  std::fclose(f);
+
+  captureformat::CaptureReader damaged;
+  damaged.open(path);
+  const size_t corrupt = damaged.verify();
+  damaged.close();
+  std::remove(path);
+
+  const double expectedX = 0.001 * (999.0 * 1000.0 / 2.0);
+  const bool ok = reader.recordCount() == kRecords && monotonic &&
+                  sumX > expectedX - 0.01 && sumX < expectedX + 0.01 &&
+                  firstBad == kRecords && corrupt == 42;
+  std::printf("records=%zu sumX=%.3f corrupt_at=%zu\n", reader.recordCount(), sumX,
+              corrupt);
+  std::printf(ok ? "capture format OK\n" : "capture format FAILED\n");
+  return ok ? 0 : 1;
+}
+#endif // CAPTURE_FORMAT_DEMO
@@ -0,0 +1,75 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        Cpp/DataAnalysis
+FILE:             CsvParserBench.cpp
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  CSV Parser Throughput Benchmark
+  Measures the csvparse engine on a synthetic in-memory capture ("timestamp,x,y,z"
+  rows), reporting bytes/s so regressions against the >1 GB/s target are visible.
+
+  Usage:
+    g++ -std=c++17 -O2 CsvParserBench.cpp -o csv_parser_bench
+    ./csv_parser_bench [--csv]
+*/
+
+#include <cstring>
+#include <string>
+
+#include "../Benchmark/MicroBenchmark.hpp"
+#include "CsvParser.hpp"
+
+int main(int argc, char **argv) {
+  const bool csv = argc > 1 && std::strcmp(argv[1], "--csv") == 0;
+
+  // ~64 MiB synthetic capture, representative row width.
+  std::string capture;
+  capture.reserve(64u << 20);
+  double ts = 0.0;
+  while (capture.size() < (64u << 20)) {
+    capture += std::to_string(ts);
+    capture += ",0.012,-0.004,1.002\n";
+    ts += 0.01;
+  }
+
+  std::vector<double> timestamps;
+  Vector3Block samples;
+
+  const auto scanResult = microbench::run(
+      "newline scan",
+      [&] {
+        size_t lines = 0;
+        csvparse::forEachLine(capture, [&](std::string_view) { ++lines; });
+        microbench::DoNotOptimize(lines);
+      },
+      {/*minSampleTimeNs=*/50'000'000, /*samples=*/7});
+
+  const auto parseResult = microbench::run(
+      "full parse to SoA",
+      [&] {
+        timestamps.clear();
+        samples.clear();
+        microbench::DoNotOptimize(csvparse::parseCapture(capture, timestamps, samples));
+      },
+      {/*minSampleTimeNs=*/50'000'000, /*samples=*/7});
+
+  if (csv) {
+    microbench::writeCsvHeader(stdout);
+    microbench::writeCsvRow(stdout, scanResult);
+    microbench::writeCsvRow(stdout, parseResult);
+  } else {
+    microbench::printResult(scanResult);
+    microbench::printResult(parseResult);
+    const double bytes = static_cast<double>(capture.size());
+    std::printf("newline scan: %.2f GB/s | full parse: %.2f GB/s (%zu rows)\n",
+                bytes / scanResult.medianNsPerOp, bytes / parseResult.medianNsPerOp,
+                samples.size());
+  }
+  return 0;
+}
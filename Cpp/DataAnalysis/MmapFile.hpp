@@ -0,0 +1,185 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        Cpp/DataAnalysis
+FILE:             MmapFile.hpp
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  Memory-Mapped File Reader Snippet
+  RAII wrapper around mmap for the data-analysis snippets: a multi-GB ADXL345 capture
+  (from the Serial_COM tools) is exposed as one contiguous read-only byte range with zero
+  copies — no istream buffer shuffling — plus madvise hints for streaming access and a
+  chunked-iteration helper that keeps per-chunk working sets cache- and TLB-friendly.
+
+  Complexity:     open is O(1); page faults stream on demand at disk/memory bandwidth.
+  Requirements:   C++17, POSIX (mmap/madvise). On Windows substitute
+                  CreateFileMapping/MapViewOfFile; the accessors are identical.
+
+  Usage:
+    MmapFile capture;
+    if (!capture.open("capture.txt")) { ... }
+    capture.adviseSequential();
+    capture.forEachChunk(1 << 20, [](std::string_view chunk) {
+      parse(chunk);     // zero-copy views into the mapping
+    });
+*/
+
+#ifndef MMAP_FILE_HPP
+#define MMAP_FILE_HPP
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+class MmapFile {
+ public:
+  MmapFile() = default;
+
+  MmapFile(const MmapFile &) = delete;
+  MmapFile &operator=(const MmapFile &) = delete;
+
+  MmapFile(MmapFile &&other) noexcept
+      : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)) {}
+
+  MmapFile &operator=(MmapFile &&other) noexcept {
+    if (this != &other) {
+      close();
+      data_ = std::exchange(other.data_, nullptr);
+      size_ = std::exchange(other.size_, 0);
+    }
+    return *this;
+  }
+
+  ~MmapFile() { close(); }
+
+  /// Maps the whole file read-only. Returns false on open/map failure.
+  bool open(const char *path) {
+    close();
+
+    const int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+      return false;
+    }
+
+    struct stat st {};
+    if (fstat(fd, &st) != 0 || st.st_size < 0) {
+      ::close(fd);
+      return false;
+    }
+    size_ = static_cast<size_t>(st.st_size);
+    if (size_ == 0) {
+      ::close(fd);
+      data_ = nullptr;
+      return true; // empty file: valid, zero-length view
+    }
+
+    void *mapped = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // the mapping keeps the file alive
+    if (mapped == MAP_FAILED) {
+      size_ = 0;
+      return false;
+    }
+    data_ = static_cast<const uint8_t *>(mapped);
+    return true;
+  }
+
+  void close() {
+    if (data_ != nullptr) {
+      ::munmap(const_cast<uint8_t *>(data_), size_);
+      data_ = nullptr;
+    }
+    size_ = 0;
+  }
+
+  bool isOpen() const { return data_ != nullptr || size_ == 0; }
+  const uint8_t *data() const { return data_; }
+  size_t size() const { return size_; }
+
+  /// Whole-file view (std::string_view doubles as a byte span in C++17).
+  std::string_view view() const {
+    return std::string_view(reinterpret_cast<const char *>(data_), size_);
+  }
+
+  /// Tells the kernel to read ahead aggressively for one front-to-back pass.
+  void adviseSequential() const { advise(MADV_SEQUENTIAL); }
+  /// Tells the kernel to start faulting pages in before first access.
+  void adviseWillNeed() const { advise(MADV_WILLNEED); }
+
+  /// Invokes fn(std::string_view) on consecutive chunks of at most chunkSize bytes.
+  /// The views alias the mapping directly — no copies are made.
+  template <typename Fn>
+  void forEachChunk(size_t chunkSize, Fn &&fn) const {
+    const std::string_view whole = view();
+    for (size_t offset = 0; offset < whole.size(); offset += chunkSize) {
+      const size_t length =
+          chunkSize < whole.size() - offset ? chunkSize : whole.size() - offset;
+      fn(whole.substr(offset, length));
+    }
+  }
+
+ private:
+  void advise(int hint) const {
+    if (data_ != nullptr) {
+      ::madvise(const_cast<uint8_t *>(data_), size_, hint);
+    }
+  }
+
+  const uint8_t *data_ = nullptr;
+  size_t size_ = 0;
+};
+
+#endif // MMAP_FILE_HPP
+
+/*
+  Demo build:
+    g++ -std=c++17 -O2 -DMMAP_FILE_DEMO -x c++ MmapFile.hpp -o mmap_demo
+*/
+#ifdef MMAP_FILE_DEMO
+#include <cstdio>
+#include <cstring>
+
+int main() {
+  // Write a small capture-like file, then read it back through the mapping.
+  const char *path = "/tmp/mmap_file_demo.txt";
+  std::FILE *out = std::fopen(path, "wb");
+  if (out == nullptr) {
+    return 1;
+  }
+  for (int i = 0; i < 1000; ++i) {
+    std::fprintf(out, "X: 0.012 g  Y: -0.004 g  Z: 1.002 g\n");
+  }
+  std::fclose(out);
+
+  MmapFile capture;
+  if (!capture.open(path)) {
+    std::printf("open failed\n");
+    return 1;
+  }
+  capture.adviseSequential();
+
+  size_t chunks = 0;
+  size_t newlines = 0;
+  capture.forEachChunk(4096, [&](std::string_view chunk) {
+    ++chunks;
+    for (char c : chunk) {
+      newlines += (c == '\n') ? 1 : 0;
+    }
+  });
+
+  std::printf("size=%zu bytes, %zu chunks, %zu lines\n", capture.size(), chunks, newlines);
+  const bool ok = newlines == 1000 && chunks == (capture.size() + 4095) / 4096;
+  std::remove(path);
+  return ok ? 0 : 1;
+}
+#endif // MMAP_FILE_DEMO
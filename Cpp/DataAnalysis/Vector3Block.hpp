@@ -0,0 +1,263 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        Cpp/DataAnalysis
+FILE:             Vector3Block.hpp
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  SoA Vector3 Batch Math Snippet
+  Structure-of-arrays counterpart of the AoS `Vector3` used in the ADXL345 sketch, meant
+  for host-side analysis of captured accelerometer logs. Storing x/y/z in three contiguous
+  arrays lets the kernels below process four (SSE) or four (NEON) lanes per instruction
+  with a scalar fallback on other targets.
+
+  Kernels:
+    - subtractBias():     removes the per-axis bias produced by calibrateADXL345().
+    - computeMagnitudes(): sqrt(x^2 + y^2 + z^2) per element.
+    - reduceStats():      min/max/RMS over any float span (axis column or magnitudes).
+
+  Complexity:     O(n) per kernel, ~4x scalar throughput with SSE/NEON.
+  Requirements:   C++17, no dependencies beyond <cmath>/<vector> (intrinsics are
+                  auto-detected via __SSE2__ / __ARM_NEON).
+
+  Usage:
+    Vector3Block block;
+    block.pushBack(1.0f, 0.0f, 0.1f);
+    subtractBias(block, bias.x, bias.y, bias.z);
+    std::vector<float> mags(block.size());
+    computeMagnitudes(block, mags.data());
+    const FloatStats stats = reduceStats(mags.data(), mags.size());
+*/
+
+#ifndef VECTOR3_BLOCK_HPP
+#define VECTOR3_BLOCK_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define VECTOR3_BLOCK_SSE 1
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define VECTOR3_BLOCK_NEON 1
+#endif
+
+/// Structure-of-arrays container for accelerometer samples.
+class Vector3Block {
+ public:
+  void reserve(size_t n) {
+    x_.reserve(n);
+    y_.reserve(n);
+    z_.reserve(n);
+  }
+
+  void pushBack(float x, float y, float z) {
+    x_.push_back(x);
+    y_.push_back(y);
+    z_.push_back(z);
+  }
+
+  void clear() {
+    x_.clear();
+    y_.clear();
+    z_.clear();
+  }
+
+  size_t size() const { return x_.size(); }
+  bool empty() const { return x_.empty(); }
+
+  float *x() { return x_.data(); }
+  float *y() { return y_.data(); }
+  float *z() { return z_.data(); }
+  const float *x() const { return x_.data(); }
+  const float *y() const { return y_.data(); }
+  const float *z() const { return z_.data(); }
+
+ private:
+  std::vector<float> x_;
+  std::vector<float> y_;
+  std::vector<float> z_;
+};
+
+/// min/max/RMS summary of a float column.
+struct FloatStats {
+  float min;
+  float max;
+  float rms;
+};
+
+namespace vector3_detail {
+
+inline void subtractBiasColumn(float *values, size_t n, float bias) {
+  size_t i = 0;
+#if defined(VECTOR3_BLOCK_SSE)
+  const __m128 vb = _mm_set1_ps(bias);
+  for (; i + 4 <= n; i += 4) {
+    _mm_storeu_ps(values + i, _mm_sub_ps(_mm_loadu_ps(values + i), vb));
+  }
+#elif defined(VECTOR3_BLOCK_NEON)
+  const float32x4_t vb = vdupq_n_f32(bias);
+  for (; i + 4 <= n; i += 4) {
+    vst1q_f32(values + i, vsubq_f32(vld1q_f32(values + i), vb));
+  }
+#endif
+  for (; i < n; ++i) {
+    values[i] -= bias;
+  }
+}
+
+} // namespace vector3_detail
+
+/// Removes the calibration bias (same model as calibrateADXL345()) from every sample.
+inline void subtractBias(Vector3Block &block, float biasX, float biasY, float biasZ) {
+  vector3_detail::subtractBiasColumn(block.x(), block.size(), biasX);
+  vector3_detail::subtractBiasColumn(block.y(), block.size(), biasY);
+  vector3_detail::subtractBiasColumn(block.z(), block.size(), biasZ);
+}
+
+/// Writes sqrt(x^2 + y^2 + z^2) for every sample into out (out must hold block.size() floats).
+inline void computeMagnitudes(const Vector3Block &block, float *out) {
+  const float *x = block.x();
+  const float *y = block.y();
+  const float *z = block.z();
+  const size_t n = block.size();
+  size_t i = 0;
+#if defined(VECTOR3_BLOCK_SSE)
+  for (; i + 4 <= n; i += 4) {
+    const __m128 vx = _mm_loadu_ps(x + i);
+    const __m128 vy = _mm_loadu_ps(y + i);
+    const __m128 vz = _mm_loadu_ps(z + i);
+    const __m128 sum = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)),
+                                  _mm_mul_ps(vz, vz));
+    _mm_storeu_ps(out + i, _mm_sqrt_ps(sum));
+  }
+#elif defined(VECTOR3_BLOCK_NEON)
+  for (; i + 4 <= n; i += 4) {
+    const float32x4_t vx = vld1q_f32(x + i);
+    const float32x4_t vy = vld1q_f32(y + i);
+    const float32x4_t vz = vld1q_f32(z + i);
+    float32x4_t sum = vmlaq_f32(vmulq_f32(vx, vx), vy, vy);
+    sum = vmlaq_f32(sum, vz, vz);
+    // One Newton-Raphson step on vrsqrte keeps the error within ~1e-3 relative.
+    float32x4_t inv = vrsqrteq_f32(sum);
+    inv = vmulq_f32(inv, vrsqrtsq_f32(vmulq_f32(sum, inv), inv));
+    vst1q_f32(out + i, vmulq_f32(sum, inv));
+  }
+#endif
+  for (; i < n; ++i) {
+    out[i] = std::sqrt(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]);
+  }
+}
+
+/// min/max/RMS reduction over a float column (an axis array or precomputed magnitudes).
+inline FloatStats reduceStats(const float *values, size_t n) {
+  FloatStats stats{0.0f, 0.0f, 0.0f};
+  if (n == 0) {
+    return stats;
+  }
+
+  size_t i = 0;
+  float minV = values[0];
+  float maxV = values[0];
+  double sumSq = 0.0;
+#if defined(VECTOR3_BLOCK_SSE)
+  if (n >= 4) {
+    __m128 vmin = _mm_loadu_ps(values);
+    __m128 vmax = vmin;
+    __m128 vsum = _mm_mul_ps(vmin, vmin);
+    for (i = 4; i + 4 <= n; i += 4) {
+      const __m128 v = _mm_loadu_ps(values + i);
+      vmin = _mm_min_ps(vmin, v);
+      vmax = _mm_max_ps(vmax, v);
+      vsum = _mm_add_ps(vsum, _mm_mul_ps(v, v));
+    }
+    float lanes[4];
+    _mm_storeu_ps(lanes, vmin);
+    minV = lanes[0];
+    for (int k = 1; k < 4; ++k) minV = lanes[k] < minV ? lanes[k] : minV;
+    _mm_storeu_ps(lanes, vmax);
+    maxV = lanes[0];
+    for (int k = 1; k < 4; ++k) maxV = lanes[k] > maxV ? lanes[k] : maxV;
+    _mm_storeu_ps(lanes, vsum);
+    sumSq = static_cast<double>(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+  }
+#elif defined(VECTOR3_BLOCK_NEON)
+  if (n >= 4) {
+    float32x4_t vmin = vld1q_f32(values);
+    float32x4_t vmax = vmin;
+    float32x4_t vsum = vmulq_f32(vmin, vmin);
+    for (i = 4; i + 4 <= n; i += 4) {
+      const float32x4_t v = vld1q_f32(values + i);
+      vmin = vminq_f32(vmin, v);
+      vmax = vmaxq_f32(vmax, v);
+      vsum = vmlaq_f32(vsum, v, v);
+    }
+    float lanes[4];
+    vst1q_f32(lanes, vmin);
+    minV = lanes[0];
+    for (int k = 1; k < 4; ++k) minV = lanes[k] < minV ? lanes[k] : minV;
+    vst1q_f32(lanes, vmax);
+    maxV = lanes[0];
+    for (int k = 1; k < 4; ++k) maxV = lanes[k] > maxV ? lanes[k] : maxV;
+    vst1q_f32(lanes, vsum);
+    sumSq = static_cast<double>(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+  }
+#endif
+  for (; i < n; ++i) {
+    const float v = values[i];
+    minV = v < minV ? v : minV;
+    maxV = v > maxV ? v : maxV;
+    sumSq += static_cast<double>(v) * v;
+  }
+
+  stats.min = minV;
+  stats.max = maxV;
+  stats.rms = static_cast<float>(std::sqrt(sumSq / static_cast<double>(n)));
+  return stats;
+}
+
+#endif // VECTOR3_BLOCK_HPP
+
+/*
+  Demo build:
+    g++ -std=c++17 -O2 -DVECTOR3_BLOCK_DEMO -x c++ Vector3Block.hpp -o vector3_demo
+*/
+#ifdef VECTOR3_BLOCK_DEMO
+#include <cstdio>
+
+int main() {
+  Vector3Block block;
+  block.reserve(1000);
+  for (int i = 0; i < 1000; ++i) {
+    const float t = static_cast<float>(i) * 0.01f;
+    block.pushBack(std::sin(t), std::cos(t), 1.0f + 0.05f * std::sin(3.0f * t));
+  }
+
+  subtractBias(block, 0.012f, -0.004f, 0.021f);
+
+  std::vector<float> mags(block.size());
+  computeMagnitudes(block, mags.data());
+
+  const FloatStats stats = reduceStats(mags.data(), mags.size());
+  std::printf("|g| min=%.4f max=%.4f rms=%.4f\n", stats.min, stats.max, stats.rms);
+
+  // Cross-check a few lanes against the scalar formula.
+  for (size_t i = 0; i < block.size(); i += 137) {
+    const float ref = std::sqrt(block.x()[i] * block.x()[i] + block.y()[i] * block.y()[i] +
+                                block.z()[i] * block.z()[i]);
+    if (std::fabs(ref - mags[i]) > 1e-3f) {
+      std::printf("Mismatch at %zu: %f vs %f\n", i, ref, mags[i]);
+      return 1;
+    }
+  }
+  std::printf("SIMD kernels match scalar reference.\n");
+  return 0;
+}
+#endif // VECTOR3_BLOCK_DEMO
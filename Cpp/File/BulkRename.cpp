@@ -0,0 +1,297 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        Cpp/File
+FILE:             BulkRename.cpp
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  Parallel Bulk-Rename Tool
+  Execution engine for large rename sets (the C++ counterpart of RenameVideo.py, which
+  renames one file at a time on the main thread). On NAS mounts each rename is a network
+  round trip, so a 50k-file pass is latency-bound, not CPU-bound: this tool plans the
+  whole set up front and then hides that latency by issuing renames concurrently, one
+  worker per directory shard so entries within a directory keep their relative order.
+
+  Planning (all before any file is touched):
+    - duplicate sources, duplicate destinations and destination-exists conflicts are
+      rejected with the offending lines;
+    - entries whose destination is another entry's source (chains, swaps, cycles) are
+      routed through a unique temporary name — phase 1 moves them aside, phase 2 lands
+      them — so a->b + b->a executes safely in any order;
+    - renames use RENAME_NOREPLACE where the kernel offers it, so a file that appears
+      between planning and execution fails the entry instead of being clobbered.
+
+  Plan input is one tab-separated `old<TAB>new` pair per line (paths relative to the
+  current directory or absolute) — e.g. emitted by a metadata pass like RenameVideo.py.
+
+  Complexity:     O(n log n) planning (hash lookups + shard sort); execution wall time
+                  ~ slowest shard instead of the sum of all round trips.
+  Requirements:   C++17 (<filesystem>, threads), POSIX. RENAME_NOREPLACE is used when
+                  <fcntl.h> provides it (Linux); plain rename() elsewhere.
+
+  Usage:
+    g++ -std=c++17 -O2 -pthread BulkRename.cpp -o bulk_rename
+    ./bulk_rename plan.tsv --dry-run          # show phases, touch nothing
+    ./bulk_rename plan.tsv --workers 16
+*/
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+struct RenameEntry {
+  fs::path from;
+  fs::path to;
+  fs::path tempPath; // non-empty when the entry must go through phase 1
+  int line = 0;
+};
+
+struct Options {
+  std::string planFile;
+  unsigned workers = 8;
+  bool dryRun = false;
+};
+
+bool parseArgs(int argc, char **argv, Options &opts) {
+  if (argc < 2) {
+    return false;
+  }
+  opts.planFile = argv[1];
+  for (int i = 2; i < argc; ++i) {
+    const std::string arg = argv[i];
+    if (arg == "--dry-run") {
+      opts.dryRun = true;
+    } else if (arg == "--workers" && i + 1 < argc) {
+      opts.workers = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+    } else {
+      std::fprintf(stderr, "Unknown argument: %s\n", arg.c_str());
+      return false;
+    }
+  }
+  return opts.workers >= 1;
+}
+
+bool loadPlan(const std::string &planFile, std::vector<RenameEntry> &entries) {
+  std::ifstream input(planFile);
+  if (!input) {
+    std::fprintf(stderr, "Cannot open plan file %s\n", planFile.c_str());
+    return false;
+  }
+  std::string line;
+  int lineNumber = 0;
+  while (std::getline(input, line)) {
+    ++lineNumber;
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    const size_t tab = line.find('\t');
+    if (tab == std::string::npos || tab == 0 || tab + 1 == line.size()) {
+      std::fprintf(stderr, "%s:%d: expected old<TAB>new\n", planFile.c_str(),
+                   lineNumber);
+      return false;
+    }
+    RenameEntry entry;
+    entry.from = fs::path(line.substr(0, tab));
+    entry.to = fs::path(line.substr(tab + 1));
+    entry.line = lineNumber;
+    entries.push_back(std::move(entry));
+  }
+  return true;
+}
+
+/// Collision checks plus two-phase routing for chains and cycles. Returns false
+/// (with diagnostics) if the plan cannot execute safely.
+bool validatePlan(std::vector<RenameEntry> &entries, const std::string &planFile) {
+  std::unordered_map<std::string, int> sources;  // path -> plan line
+  std::unordered_map<std::string, int> targets;
+  bool ok = true;
+
+  for (const RenameEntry &entry : entries) {
+    const std::string from = entry.from.lexically_normal().string();
+    const std::string to = entry.to.lexically_normal().string();
+    if (!sources.emplace(from, entry.line).second) {
+      std::fprintf(stderr, "%s:%d: source %s already renamed on line %d\n",
+                   planFile.c_str(), entry.line, from.c_str(), sources[from]);
+      ok = false;
+    }
+    if (!targets.emplace(to, entry.line).second) {
+      std::fprintf(stderr, "%s:%d: destination %s already used on line %d\n",
+                   planFile.c_str(), entry.line, to.c_str(), targets[to]);
+      ok = false;
+    }
+    if (!fs::exists(fs::symlink_status(entry.from))) {
+      std::fprintf(stderr, "%s:%d: source %s does not exist\n", planFile.c_str(),
+                   entry.line, from.c_str());
+      ok = false;
+    }
+  }
+  if (!ok) {
+    return false;
+  }
+
+  size_t tempCount = 0;
+  for (RenameEntry &entry : entries) {
+    const std::string to = entry.to.lexically_normal().string();
+    const auto asSource = sources.find(to);
+    if (asSource != sources.end()) {
+      // Destination is also being renamed away (chain or cycle): go two-phase.
+      entry.tempPath = entry.to;
+      entry.tempPath += ".bulkrename." + std::to_string(tempCount++) + ".tmp";
+    } else if (fs::exists(fs::symlink_status(entry.to))) {
+      std::fprintf(stderr, "%s:%d: destination %s already exists\n",
+                   planFile.c_str(), entry.line, to.c_str());
+      ok = false;
+    }
+  }
+  return ok;
+}
+
+int renameNoReplace(const fs::path &from, const fs::path &to) {
+#ifdef RENAME_NOREPLACE
+  return renameat2(AT_FDCWD, from.c_str(), AT_FDCWD, to.c_str(), RENAME_NOREPLACE);
+#else
+  return ::rename(from.c_str(), to.c_str());
+#endif
+}
+
+/// One shard = all entries whose source lives in the same directory; shards run
+/// concurrently, entries within a shard run in plan order.
+std::vector<std::vector<const RenameEntry *>> shardByDirectory(
+    const std::vector<RenameEntry> &entries) {
+  std::unordered_map<std::string, size_t> shardIndex;
+  std::vector<std::vector<const RenameEntry *>> shards;
+  for (const RenameEntry &entry : entries) {
+    const std::string dir = entry.from.parent_path().string();
+    auto [it, inserted] = shardIndex.emplace(dir, shards.size());
+    if (inserted) {
+      shards.emplace_back();
+    }
+    shards[it->second].push_back(&entry);
+  }
+  return shards;
+}
+
+/// Runs `step` over every entry, shard-parallel. Returns the number of failures.
+template <typename Step>
+size_t runPhase(const std::vector<std::vector<const RenameEntry *>> &shards,
+                unsigned workers, Step step) {
+  std::atomic<size_t> nextShard{0};
+  std::atomic<size_t> failures{0};
+  auto worker = [&] {
+    for (;;) {
+      const size_t shard = nextShard.fetch_add(1, std::memory_order_relaxed);
+      if (shard >= shards.size()) {
+        return;
+      }
+      for (const RenameEntry *entry : shards[shard]) {
+        if (!step(*entry)) {
+          failures.fetch_add(1, std::memory_order_relaxed);
+        }
+      }
+    }
+  };
+
+  const unsigned threadCount =
+      static_cast<unsigned>(std::min<size_t>(workers, shards.size()));
+  std::vector<std::thread> threads;
+  for (unsigned i = 1; i < threadCount; ++i) {
+    threads.emplace_back(worker);
+  }
+  worker(); // the calling thread works too
+  for (std::thread &t : threads) {
+    t.join();
+  }
+  return failures.load();
+}
+
+bool renameStep(const fs::path &from, const fs::path &to) {
+  if (renameNoReplace(from, to) != 0) {
+    std::fprintf(stderr, "rename %s -> %s failed: %s\n", from.c_str(), to.c_str(),
+                 std::strerror(errno));
+    return false;
+  }
+  return true;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  Options opts;
+  if (!parseArgs(argc, argv, opts)) {
+    std::fprintf(stderr,
+                 "Usage: %s plan.tsv [--dry-run] [--workers N]\n"
+                 "  plan.tsv: one old<TAB>new pair per line, # comments allowed\n",
+                 argv[0]);
+    return 2;
+  }
+
+  std::vector<RenameEntry> entries;
+  if (!loadPlan(opts.planFile, entries)) {
+    return 1;
+  }
+  if (entries.empty()) {
+    std::printf("Plan is empty, nothing to do.\n");
+    return 0;
+  }
+  if (!validatePlan(entries, opts.planFile)) {
+    std::fprintf(stderr, "Plan rejected, no file was touched.\n");
+    return 1;
+  }
+
+  const auto shards = shardByDirectory(entries);
+  size_t twoPhase = 0;
+  for (const RenameEntry &entry : entries) {
+    twoPhase += entry.tempPath.empty() ? 0 : 1;
+  }
+  std::printf("%zu renames in %zu directory shards (%zu via temp names)\n",
+              entries.size(), shards.size(), twoPhase);
+
+  if (opts.dryRun) {
+    for (const RenameEntry &entry : entries) {
+      if (entry.tempPath.empty()) {
+        std::printf("  %s -> %s\n", entry.from.c_str(), entry.to.c_str());
+      } else {
+        std::printf("  %s -> %s -> %s\n", entry.from.c_str(),
+                    entry.tempPath.c_str(), entry.to.c_str());
+      }
+    }
+    return 0;
+  }
+
+  // Phase 1: move chain/cycle members aside; direct entries rename for real.
+  size_t failures = runPhase(shards, opts.workers, [](const RenameEntry &entry) {
+    return renameStep(entry.from,
+                      entry.tempPath.empty() ? entry.to : entry.tempPath);
+  });
+
+  // Phase 2: land the temp names on their now-free destinations.
+  failures += runPhase(shards, opts.workers, [](const RenameEntry &entry) {
+    return entry.tempPath.empty() || renameStep(entry.tempPath, entry.to);
+  });
+
+  if (failures > 0) {
+    std::fprintf(stderr, "%zu of %zu renames failed.\n", failures, entries.size());
+    return 1;
+  }
+  std::printf("All %zu renames completed.\n", entries.size());
+  return 0;
+}
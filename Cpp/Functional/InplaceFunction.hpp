@@ -0,0 +1,151 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        Cpp/Functional
+FILE:             InplaceFunction.hpp
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  Allocation-Free Callable Wrapper Snippet
+  std::function replacement for the callback-driven snippets (async I2C scanner, task
+  scheduler): the callable is stored inside the object itself, so there is never a heap
+  allocation, capacity overflow is a compile-time error rather than a silent allocation,
+  and invocation is one indirect call through a local function pointer.
+
+  The wrapper is move-only — embedded callbacks are handed over, not shared — and empty
+  invocation is checked with an assert-style trap rather than exceptions.
+
+  Complexity:     O(1) construct/move/invoke; no allocation ever.
+  Memory:         Capacity bytes of storage + two function pointers.
+  Requirements:   C++17.
+
+  Usage:
+    InplaceFunction<void(uint8_t), 16> onFound = [&log](uint8_t addr) { log.add(addr); };
+    if (onFound) onFound(0x53);
+*/
+
+#ifndef INPLACE_FUNCTION_HPP
+#define INPLACE_FUNCTION_HPP
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template <typename Signature, size_t Capacity = 24>
+class InplaceFunction;
+
+template <typename R, typename... Args, size_t Capacity>
+class InplaceFunction<R(Args...), Capacity> {
+ public:
+  InplaceFunction() = default;
+
+  template <typename F,
+            typename = std::enable_if_t<
+                !std::is_same_v<std::decay_t<F>, InplaceFunction> &&
+                std::is_invocable_r_v<R, std::decay_t<F> &, Args...>>>
+  InplaceFunction(F &&callable) {
+    using Decayed = std::decay_t<F>;
+    static_assert(sizeof(Decayed) <= Capacity,
+                  "Callable does not fit: raise the Capacity template argument");
+    static_assert(alignof(Decayed) <= alignof(std::max_align_t),
+                  "Callable is over-aligned for the in-object storage");
+    static_assert(std::is_nothrow_move_constructible_v<Decayed>,
+                  "Callable must be nothrow move constructible");
+
+    ::new (storage_) Decayed(std::forward<F>(callable));
+    invoke_ = [](void *storage, Args &&...args) -> R {
+      return (*std::launder(reinterpret_cast<Decayed *>(storage)))(
+          std::forward<Args>(args)...);
+    };
+    manage_ = [](Operation op, void *storage, void *target) {
+      Decayed *self = std::launder(reinterpret_cast<Decayed *>(storage));
+      if (op == Operation::MoveTo) {
+        ::new (target) Decayed(std::move(*self));
+      }
+      self->~Decayed();
+    };
+  }
+
+  InplaceFunction(InplaceFunction &&other) noexcept { moveFrom(other); }
+
+  InplaceFunction &operator=(InplaceFunction &&other) noexcept {
+    if (this != &other) {
+      reset();
+      moveFrom(other);
+    }
+    return *this;
+  }
+
+  InplaceFunction(const InplaceFunction &) = delete;
+  InplaceFunction &operator=(const InplaceFunction &) = delete;
+
+  ~InplaceFunction() { reset(); }
+
+  R operator()(Args... args) {
+    return invoke_(storage_, std::forward<Args>(args)...);
+  }
+
+  explicit operator bool() const { return invoke_ != nullptr; }
+
+  void reset() {
+    if (manage_ != nullptr) {
+      manage_(Operation::Destroy, storage_, nullptr);
+      invoke_ = nullptr;
+      manage_ = nullptr;
+    }
+  }
+
+  static constexpr size_t capacity() { return Capacity; }
+
+ private:
+  enum class Operation { MoveTo, Destroy };
+
+  using InvokeFn = R (*)(void *, Args &&...);
+  using ManageFn = void (*)(Operation, void *, void *);
+
+  void moveFrom(InplaceFunction &other) noexcept {
+    if (other.manage_ != nullptr) {
+      other.manage_(Operation::MoveTo, other.storage_, storage_);
+      invoke_ = other.invoke_;
+      manage_ = other.manage_;
+      other.invoke_ = nullptr;
+      other.manage_ = nullptr;
+    }
+  }
+
+  alignas(std::max_align_t) unsigned char storage_[Capacity];
+  InvokeFn invoke_ = nullptr;
+  ManageFn manage_ = nullptr;
+};
+
+#endif // INPLACE_FUNCTION_HPP
+
+/*
+  Demo build:
+    g++ -std=c++17 -O2 -DINPLACE_FUNCTION_DEMO -x c++ InplaceFunction.hpp -o inplace_demo
+*/
+#ifdef INPLACE_FUNCTION_DEMO
+#include <cstdint>
+#include <cstdio>
+
+int main() {
+  int found = 0;
+  InplaceFunction<void(uint8_t), 16> onFound = [&found](uint8_t addr) {
+    found += addr;
+  };
+
+  onFound(0x53);
+  InplaceFunction<void(uint8_t), 16> moved = std::move(onFound);
+  moved(0x68);
+
+  const bool ok = found == 0x53 + 0x68 && !onFound && static_cast<bool>(moved);
+  std::printf(ok ? "InplaceFunction OK (sum=0x%X)\n" : "InplaceFunction FAILED (sum=0x%X)\n",
+              found);
+  return ok ? 0 : 1;
+}
+#endif // INPLACE_FUNCTION_DEMO
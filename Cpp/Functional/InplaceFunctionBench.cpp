@@ -0,0 +1,69 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        Cpp/Functional
+FILE:             InplaceFunctionBench.cpp
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  InplaceFunction Call-Overhead Benchmark
+  Compares invocation cost of a raw function pointer, InplaceFunction, and std::function
+  for the capturing-lambda callback shape used by the scanner/scheduler snippets.
+
+  Usage:
+    g++ -std=c++17 -O2 InplaceFunctionBench.cpp -o inplace_function_bench
+    ./inplace_function_bench [--csv]
+*/
+
+#include <cstring>
+#include <functional>
+
+#include "../Benchmark/MicroBenchmark.hpp"
+#include "InplaceFunction.hpp"
+
+namespace {
+
+volatile int g_sink = 0;
+
+int freeFunction(int value) { return value + 1; }
+
+} // namespace
+
+int main(int argc, char **argv) {
+  const bool csv = argc > 1 && std::strcmp(argv[1], "--csv") == 0;
+
+  int captured = 7;
+  int (*rawPointer)(int) = freeFunction;
+  InplaceFunction<int(int), 16> inplace = [&captured](int value) {
+    return value + captured;
+  };
+  std::function<int(int)> stdFunction = [&captured](int value) {
+    return value + captured;
+  };
+
+  const auto rawResult = microbench::run("raw function pointer", [&] {
+    microbench::DoNotOptimize(rawPointer(g_sink));
+  });
+  const auto inplaceResult = microbench::run("InplaceFunction", [&] {
+    microbench::DoNotOptimize(inplace(g_sink));
+  });
+  const auto stdResult = microbench::run("std::function", [&] {
+    microbench::DoNotOptimize(stdFunction(g_sink));
+  });
+
+  if (csv) {
+    microbench::writeCsvHeader(stdout);
+    microbench::writeCsvRow(stdout, rawResult);
+    microbench::writeCsvRow(stdout, inplaceResult);
+    microbench::writeCsvRow(stdout, stdResult);
+  } else {
+    microbench::printResult(rawResult);
+    microbench::printResult(inplaceResult);
+    microbench::printResult(stdResult);
+  }
+  return 0;
+}
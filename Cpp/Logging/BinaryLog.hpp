@@ -0,0 +1,289 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        Cpp/Logging
+FILE:             BinaryLog.hpp
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  Deferred-Formatting Binary Log Snippet
+  printAcceleration() in ADXL345.ino spends its loop budget turning floats into ASCII and
+  then saturates the UART with the result. This header moves formatting off the MCU:
+  each log statement is described once by a constexpr LogRecordDef (numeric ID, printf
+  format string, field types); the MCU emits only sync byte + ID + raw little-endian
+  payload, and the host decoder (BinaryLogDecode.cpp) re-expands records to the familiar
+  text. A record that printed ~40 ASCII bytes becomes 2 + payload bytes on the wire.
+
+  Complexity:     O(payload) memcpy per record on the MCU; zero formatting cost on-device.
+  Requirements:   C++17 on the host; the encoder also compiles on Arduino/STM32 (no heap,
+                  byte sink is any callable `void(const uint8_t*, size_t)`).
+
+  Usage (MCU side, sink wraps Serial.write or a DMA ring):
+    constexpr binarylog::FieldType kAccelFields[] = {
+        binarylog::FieldType::F32, binarylog::FieldType::F32,
+        binarylog::FieldType::F32, binarylog::FieldType::F32};
+    constexpr binarylog::LogRecordDef kAccelRecord{
+        1, "X: %.3f g  Y: %.3f g  Z: %.3f g  |g|: %.3f g", kAccelFields, 4};
+    binarylog::Encoder<Sink> log(sink);
+    log.emit(kAccelRecord, g.x, g.y, g.z, mag);
+*/
+
+#ifndef BINARY_LOG_HPP
+#define BINARY_LOG_HPP
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+namespace binarylog {
+
+constexpr uint8_t kSyncByte = 0xA5;
+
+enum class FieldType : uint8_t { U8, U16, U32, I8, I16, I32, F32 };
+
+constexpr uint8_t fieldSize(FieldType type) {
+  return (type == FieldType::U8 || type == FieldType::I8)    ? 1
+         : (type == FieldType::U16 || type == FieldType::I16) ? 2
+                                                              : 4;
+}
+
+/// One log statement: shared by the firmware (payload layout) and the host (format).
+struct LogRecordDef {
+  uint8_t id;
+  const char *format;     // printf-style, one specifier per field
+  const FieldType *fields;
+  uint8_t fieldCount;
+
+  constexpr uint8_t payloadSize() const {
+    uint8_t total = 0;
+    for (uint8_t i = 0; i < fieldCount; ++i) {
+      total = static_cast<uint8_t>(total + fieldSize(fields[i]));
+    }
+    return total;
+  }
+};
+
+namespace detail {
+
+// Little-endian serialization, independent of the MCU's native byte order.
+inline uint8_t *putLE(uint8_t *out, uint32_t value, uint8_t bytes) {
+  for (uint8_t i = 0; i < bytes; ++i) {
+    *out++ = static_cast<uint8_t>(value >> (8 * i));
+  }
+  return out;
+}
+
+inline uint8_t *putField(uint8_t *out, FieldType type, float value) {
+  uint32_t bits = 0;
+  memcpy(&bits, &value, sizeof(bits));
+  (void)type;
+  return putLE(out, bits, 4);
+}
+
+inline uint8_t *putField(uint8_t *out, FieldType type, uint32_t value) {
+  return putLE(out, value, fieldSize(type));
+}
+
+inline uint8_t *putField(uint8_t *out, FieldType type, int32_t value) {
+  return putLE(out, static_cast<uint32_t>(value), fieldSize(type));
+}
+
+} // namespace detail
+
+/// Emits framed binary records through a byte sink (Serial.write, fwrite, DMA ring...).
+template <typename Sink>
+class Encoder {
+ public:
+  explicit Encoder(Sink sink) : sink_(sink) {}
+
+  template <typename... Args>
+  void emit(const LogRecordDef &def, Args... args) {
+    uint8_t frame[2 + kMaxPayload];
+    frame[0] = kSyncByte;
+    frame[1] = def.id;
+    uint8_t *cursor = frame + 2;
+    uint8_t index = 0;
+    ((cursor = writeArg(cursor, def, index++, args)), ...);
+    sink_(frame, static_cast<size_t>(cursor - frame));
+  }
+
+ private:
+  static constexpr uint8_t kMaxPayload = 64;
+
+  static uint8_t *writeArg(uint8_t *cursor, const LogRecordDef &def, uint8_t index,
+                           float value) {
+    return detail::putField(cursor, def.fields[index], value);
+  }
+  static uint8_t *writeArg(uint8_t *cursor, const LogRecordDef &def, uint8_t index,
+                           double value) {
+    return detail::putField(cursor, def.fields[index], static_cast<float>(value));
+  }
+  template <typename T>
+  static uint8_t *writeArg(uint8_t *cursor, const LogRecordDef &def, uint8_t index,
+                           T value) {
+    if (static_cast<T>(-1) < static_cast<T>(0)) {
+      return detail::putField(cursor, def.fields[index], static_cast<int32_t>(value));
+    }
+    return detail::putField(cursor, def.fields[index], static_cast<uint32_t>(value));
+  }
+
+  Sink sink_;
+};
+
+/// Incremental host-side decoder: feed raw bytes, get formatted text per record.
+/// Lookup is a linear scan over the table — record tables are small by construction.
+class Decoder {
+ public:
+  Decoder(const LogRecordDef *table, size_t tableSize)
+      : table_(table), tableSize_(tableSize) {}
+
+  /// Formats up to outSize chars into out when a full record has been consumed.
+  /// Returns the number of input bytes consumed; *decoded is true when out is valid.
+  size_t feed(const uint8_t *data, size_t length, char *out, size_t outSize,
+              bool *decoded) {
+    *decoded = false;
+    size_t consumed = 0;
+
+    // Resynchronize on the sync byte (corrupted or mid-stream captures).
+    while (consumed < length && data[consumed] != kSyncByte) {
+      ++consumed;
+    }
+    if (length - consumed < 2) {
+      return consumed;
+    }
+
+    const LogRecordDef *def = findRecord(data[consumed + 1]);
+    if (def == nullptr) {
+      return consumed + 1; // unknown ID: skip the sync byte and rescan
+    }
+
+    const size_t frameSize = 2u + def->payloadSize();
+    if (length - consumed < frameSize) {
+      return consumed; // wait for the rest of the frame
+    }
+
+    formatRecord(*def, data + consumed + 2, out, outSize);
+    *decoded = true;
+    return consumed + frameSize;
+  }
+
+ private:
+  const LogRecordDef *findRecord(uint8_t id) const {
+    for (size_t i = 0; i < tableSize_; ++i) {
+      if (table_[i].id == id) {
+        return &table_[i];
+      }
+    }
+    return nullptr;
+  }
+
+  static uint32_t getLE(const uint8_t *in, uint8_t bytes) {
+    uint32_t value = 0;
+    for (uint8_t i = 0; i < bytes; ++i) {
+      value |= static_cast<uint32_t>(in[i]) << (8 * i);
+    }
+    return value;
+  }
+
+  static void formatRecord(const LogRecordDef &def, const uint8_t *payload, char *out,
+                           size_t outSize);
+
+  const LogRecordDef *table_;
+  size_t tableSize_;
+};
+
+inline void Decoder::formatRecord(const LogRecordDef &def, const uint8_t *payload,
+                                  char *out, size_t outSize) {
+  const char *fmt = def.format;
+  size_t written = 0;
+  uint8_t field = 0;
+
+  while (*fmt != '\0' && written + 1 < outSize) {
+    if (*fmt != '%' || field >= def.fieldCount) {
+      out[written++] = *fmt++;
+      continue;
+    }
+
+    // Copy the whole specifier ("%.3f", "%04X", ...) and hand it to snprintf.
+    char spec[16];
+    size_t specLen = 0;
+    spec[specLen++] = *fmt++;
+    while (*fmt != '\0' && specLen + 1 < sizeof(spec) &&
+           strchr("diuxXf", *fmt) == nullptr) {
+      spec[specLen++] = *fmt++;
+    }
+    const char conversion = *fmt;
+    if (conversion != '\0') {
+      spec[specLen++] = *fmt++;
+    }
+    spec[specLen] = '\0';
+
+    const FieldType type = def.fields[field];
+    const uint8_t bytes = fieldSize(type);
+    const uint32_t raw = getLE(payload, bytes);
+    payload += bytes;
+    ++field;
+
+    int n = 0;
+    if (conversion == 'f') {
+      float value = 0.0f;
+      memcpy(&value, &raw, sizeof(value));
+      n = snprintf(out + written, outSize - written, spec, static_cast<double>(value));
+    } else if (type == FieldType::I8 || type == FieldType::I16 || type == FieldType::I32) {
+      // Sign-extend from the serialized width.
+      int32_t value = static_cast<int32_t>(raw << (32 - 8 * bytes)) >> (32 - 8 * bytes);
+      n = snprintf(out + written, outSize - written, spec, value);
+    } else {
+      n = snprintf(out + written, outSize - written, spec, raw);
+    }
+    if (n > 0) {
+      written += static_cast<size_t>(n) < outSize - written ? static_cast<size_t>(n)
+                                                            : outSize - written - 1;
+    }
+  }
+  out[written] = '\0';
+}
+
+} // namespace binarylog
+
+#endif // BINARY_LOG_HPP
+
+/*
+  Demo build:
+    g++ -std=c++17 -O2 -DBINARY_LOG_DEMO -x c++ BinaryLog.hpp -o binarylog_demo
+*/
+#ifdef BINARY_LOG_DEMO
+#include <cstdio>
+#include <vector>
+
+namespace {
+constexpr binarylog::FieldType kAccelFields[] = {
+    binarylog::FieldType::F32, binarylog::FieldType::F32, binarylog::FieldType::F32,
+    binarylog::FieldType::F32};
+constexpr binarylog::LogRecordDef kAccelRecord{
+    1, "X: %.3f g  Y: %.3f g  Z: %.3f g  |g|: %.3f g", kAccelFields, 4};
+} // namespace
+
+int main() {
+  std::vector<uint8_t> wire;
+  auto sink = [&wire](const uint8_t *data, size_t length) {
+    wire.insert(wire.end(), data, data + length);
+  };
+
+  binarylog::Encoder<decltype(sink)> log(sink);
+  log.emit(kAccelRecord, 0.012f, -0.004f, 1.002f, 1.00209f);
+
+  std::printf("wire bytes per record: %zu (text was ~40)\n", wire.size());
+
+  binarylog::Decoder decoder(&kAccelRecord, 1);
+  char line[128];
+  bool decoded = false;
+  decoder.feed(wire.data(), wire.size(), line, sizeof(line), &decoded);
+  std::printf("%s\n", decoded ? line : "(decode failed)");
+  return decoded && wire.size() == 2 + 16 ? 0 : 1;
+}
+#endif // BINARY_LOG_DEMO
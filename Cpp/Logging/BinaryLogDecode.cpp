@@ -0,0 +1,100 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        Cpp/Logging
+FILE:             BinaryLogDecode.cpp
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  Binary Log Decoder Tool
+  Host-side companion of BinaryLog.hpp: reads a binary capture (file or stdin, e.g. taken
+  with the Serial_COM capture tools) and expands each record back to human-readable text.
+  The record table below must match the firmware's definitions — extend it alongside each
+  new log statement.
+
+  Usage:
+    g++ -std=c++17 -O2 BinaryLogDecode.cpp -o binary_log_decode
+    ./binary_log_decode capture.bin
+    ./serial_save_data /dev/stdout ... | ./binary_log_decode -
+*/
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "BinaryLog.hpp"
+
+namespace {
+
+// Mirror of the firmware's record definitions (IDs and payload layouts must match).
+constexpr binarylog::FieldType kAccelFields[] = {
+    binarylog::FieldType::F32, binarylog::FieldType::F32, binarylog::FieldType::F32,
+    binarylog::FieldType::F32};
+constexpr binarylog::FieldType kBiasFields[] = {
+    binarylog::FieldType::F32, binarylog::FieldType::F32, binarylog::FieldType::F32};
+constexpr binarylog::FieldType kScanFields[] = {binarylog::FieldType::U8};
+
+constexpr binarylog::LogRecordDef kRecordTable[] = {
+    {1, "X: %.3f g  Y: %.3f g  Z: %.3f g  |g|: %.3f g", kAccelFields, 4},
+    {2, "Bias (g): %.4f, %.4f, %.4f", kBiasFields, 3},
+    {3, "I2C device 0x%02x (ACK)", kScanFields, 1},
+};
+constexpr size_t kRecordCount = sizeof(kRecordTable) / sizeof(kRecordTable[0]);
+
+} // namespace
+
+int main(int argc, char **argv) {
+  if (argc != 2) {
+    std::fprintf(stderr, "Usage: %s <capture.bin | ->\n", argv[0]);
+    return 1;
+  }
+
+  std::FILE *in = stdin;
+  if (std::strcmp(argv[1], "-") != 0) {
+    in = std::fopen(argv[1], "rb");
+    if (in == nullptr) {
+      std::fprintf(stderr, "Cannot open %s\n", argv[1]);
+      return 1;
+    }
+  }
+
+  binarylog::Decoder decoder(kRecordTable, kRecordCount);
+  std::vector<uint8_t> pending;
+  uint8_t chunk[4096];
+  char line[256];
+  unsigned long records = 0;
+
+  for (;;) {
+    const size_t n = std::fread(chunk, 1, sizeof(chunk), in);
+    if (n == 0) {
+      break;
+    }
+    pending.insert(pending.end(), chunk, chunk + n);
+
+    size_t offset = 0;
+    for (;;) {
+      bool decoded = false;
+      const size_t consumed = decoder.feed(pending.data() + offset,
+                                           pending.size() - offset, line, sizeof(line),
+                                           &decoded);
+      offset += consumed;
+      if (decoded) {
+        std::printf("%s\n", line);
+        ++records;
+      } else if (consumed == 0 || offset >= pending.size()) {
+        break; // need more input for the next frame
+      }
+    }
+    pending.erase(pending.begin(), pending.begin() + static_cast<long>(offset));
+  }
+
+  if (in != stdin) {
+    std::fclose(in);
+  }
+  std::fprintf(stderr, "Decoded %lu records.\n", records);
+  return 0;
+}
@@ -0,0 +1,173 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        Cpp/Memory
+FILE:             ObjectPool.hpp
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  Fixed-Block Object Pool Snippet
+  Freelist-backed pool of N fixed-size slots: acquire() pops a slot and constructs in
+  place, release() destroys and pushes the slot back. All storage is in-object, so the
+  pool suits both firmware (no heap at all) and host tools that want to cap and recycle
+  allocations of one hot type. A std::pmr adapter exposes the same slots to standard
+  containers holding that type.
+
+  Complexity:     O(1) acquire/release; no allocation ever.
+  Memory:         max(sizeof(T), pointer) * N + freelist head, all in-object.
+  Requirements:   C++17 (<memory_resource> for the adapter).
+
+  Usage:
+    ObjectPool<Connection, 32> pool;
+    Connection *conn = pool.acquire(socketFd);
+    ...
+    pool.release(conn);
+*/
+
+#ifndef OBJECT_POOL_HPP
+#define OBJECT_POOL_HPP
+
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template <typename T, size_t N>
+class ObjectPool {
+  static_assert(N > 0, "Pool must hold at least one object");
+
+ public:
+  ObjectPool() : freeHead_(nullptr), available_(N) {
+    // Thread every slot onto the freelist (LIFO keeps recently used slots cache-hot).
+    for (size_t i = N; i > 0; --i) {
+      pushFree(&slots_[i - 1]);
+    }
+  }
+
+  ObjectPool(const ObjectPool &) = delete;
+  ObjectPool &operator=(const ObjectPool &) = delete;
+
+  /// Constructs a T in a free slot; returns nullptr when the pool is exhausted.
+  template <typename... Args>
+  T *acquire(Args &&...args) {
+    Slot *slot = popFree();
+    if (slot == nullptr) {
+      return nullptr;
+    }
+    --available_;
+    return ::new (slot->storage) T(std::forward<Args>(args)...);
+  }
+
+  /// Destroys the object and returns its slot to the freelist.
+  void release(T *object) {
+    if (object == nullptr) {
+      return;
+    }
+    object->~T();
+    pushFree(reinterpret_cast<Slot *>(object));
+    ++available_;
+  }
+
+  size_t available() const { return available_; }
+  static constexpr size_t capacity() { return N; }
+
+ private:
+  union Slot {
+    Slot *next;
+    alignas(T) unsigned char storage[sizeof(T)];
+  };
+
+  void pushFree(Slot *slot) {
+    slot->next = freeHead_;
+    freeHead_ = slot;
+  }
+
+  Slot *popFree() {
+    Slot *slot = freeHead_;
+    if (slot != nullptr) {
+      freeHead_ = slot->next;
+    }
+    return slot;
+  }
+
+  Slot slots_[N];
+  Slot *freeHead_;
+  size_t available_;
+};
+
+/// std::pmr adapter serving fixed blocks of sizeof(T) from an ObjectPool's slot space.
+/// Suitable for node-based pmr containers (std::pmr::list/map of T-sized nodes) or any
+/// resource request that fits one slot; larger requests fail with bad_alloc.
+template <typename T, size_t N>
+class PoolMemoryResource : public std::pmr::memory_resource {
+ public:
+  PoolMemoryResource() = default;
+
+ private:
+  struct RawBlock {
+    alignas(T) unsigned char bytes[sizeof(T)];
+  };
+
+  void *do_allocate(size_t bytes, size_t alignment) override {
+    if (bytes > sizeof(RawBlock) || alignment > alignof(RawBlock)) {
+      throw std::bad_alloc();
+    }
+    RawBlock *block = pool_.acquire();
+    if (block == nullptr) {
+      throw std::bad_alloc();
+    }
+    return block;
+  }
+
+  void do_deallocate(void *ptr, size_t, size_t) override {
+    pool_.release(static_cast<RawBlock *>(ptr));
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+
+  ObjectPool<RawBlock, N> pool_;
+};
+
+#endif // OBJECT_POOL_HPP
+
+/*
+  Demo build:
+    g++ -std=c++17 -O2 -DOBJECT_POOL_DEMO -x c++ ObjectPool.hpp -o pool_demo
+*/
+#ifdef OBJECT_POOL_DEMO
+#include <cstdio>
+
+namespace {
+struct Probe {
+  explicit Probe(int id) : id(id) { ++alive; }
+  ~Probe() { --alive; }
+  int id;
+  static int alive;
+};
+int Probe::alive = 0;
+} // namespace
+
+int main() {
+  ObjectPool<Probe, 4> pool;
+
+  Probe *a = pool.acquire(1);
+  Probe *b = pool.acquire(2);
+  pool.release(a);
+  Probe *c = pool.acquire(3); // reuses a's slot (LIFO freelist)
+
+  const bool reused = (c == a);
+  pool.release(b);
+  pool.release(c);
+
+  std::printf("slot reused: %s, alive after release: %d, available: %zu\n",
+              reused ? "yes" : "no", Probe::alive, pool.available());
+  return (reused && Probe::alive == 0 && pool.available() == 4) ? 0 : 1;
+}
+#endif // OBJECT_POOL_DEMO
@@ -0,0 +1,127 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        Cpp/Scheduler
+FILE:             TaskScheduler.hpp
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  Cooperative Task Scheduler Snippet
+  Generalizes the wrap-safe periodic pattern demonstrated in Arduino/Utility/OverflowMillis.ino
+  (`next += PERIOD` with signed-delta comparison) into a reusable compile-time task table.
+  Tasks are plain function pointers with fixed periods, declared in a constexpr std::array;
+  dispatch is a direct call per due task with no virtual calls, no heap, and no runtime
+  registration, so tick() overhead stays deterministic enough for a 1 kHz control loop.
+
+  Complexity:     O(N) scan per tick over the compile-time table, O(1) dispatch per task.
+  Memory:         N * (function pointer + period + deadline), all static.
+  Requirements:   C++17. The tick source is caller-provided (millis() on Arduino,
+                  HAL_GetTick() on STM32, any monotonic 32-bit counter on the host) and may
+                  wrap: deadlines survive the 2^32 rollover exactly like OverflowMillis.ino.
+
+  Usage (Arduino):
+    void sampleTask();
+    void printTask();
+    constexpr std::array<SchedulerTask, 2> kTasks{{
+        {sampleTask, 10},    // every 10 ms
+        {printTask, 1000},   // every 1 s
+    }};
+    TaskScheduler<2> scheduler(kTasks);
+    void setup() { scheduler.start(millis()); }
+    void loop() { scheduler.tick(millis()); }
+*/
+
+#ifndef TASK_SCHEDULER_HPP
+#define TASK_SCHEDULER_HPP
+
+#include <stdint.h>
+
+#include <array>
+#include <cstddef>
+
+/// One entry of the compile-time task table.
+struct SchedulerTask {
+  void (*run)();
+  uint32_t periodTicks;
+};
+
+template <size_t N>
+class TaskScheduler {
+  static_assert(N > 0, "The task table must contain at least one task");
+
+ public:
+  constexpr explicit TaskScheduler(const std::array<SchedulerTask, N> &tasks)
+      : tasks_(tasks), deadlines_{} {}
+
+  /// Aligns every deadline to the current tick; call once before the first tick().
+  void start(uint32_t now) {
+    for (size_t i = 0; i < N; ++i) {
+      deadlines_[i] = now + tasks_[i].periodTicks;
+    }
+  }
+
+  /// Runs every task whose deadline has passed. The signed-delta comparison keeps
+  /// working across the 32-bit wrap, and `deadline += period` (instead of `now +
+  /// period`) prevents drift when a tick arrives late — both straight out of
+  /// OverflowMillis.ino.
+  void tick(uint32_t now) {
+    for (size_t i = 0; i < N; ++i) {
+      while (static_cast<int32_t>(now - deadlines_[i]) >= 0) {
+        tasks_[i].run();
+        deadlines_[i] += tasks_[i].periodTicks;
+      }
+    }
+  }
+
+  static constexpr size_t taskCount() { return N; }
+
+ private:
+  std::array<SchedulerTask, N> tasks_;
+  std::array<uint32_t, N> deadlines_;
+};
+
+/// Deduction helper so callers can write TaskScheduler scheduler(kTasks);
+template <size_t N>
+TaskScheduler(const std::array<SchedulerTask, N> &) -> TaskScheduler<N>;
+
+#endif // TASK_SCHEDULER_HPP
+
+/*
+  Demo build:
+    g++ -std=c++17 -O2 -DTASK_SCHEDULER_DEMO -x c++ TaskScheduler.hpp -o scheduler_demo
+*/
+#ifdef TASK_SCHEDULER_DEMO
+#include <cstdio>
+
+namespace {
+int fastRuns = 0;
+int slowRuns = 0;
+void fastTask() { ++fastRuns; }
+void slowTask() { ++slowRuns; }
+} // namespace
+
+int main() {
+  constexpr std::array<SchedulerTask, 2> kTasks{{
+      {fastTask, 10},
+      {slowTask, 1000},
+  }};
+  TaskScheduler scheduler(kTasks);
+
+  // Start close to the 32-bit rollover, as OverflowMillis.ino does, to prove the
+  // deadlines survive the wrap.
+  uint32_t now = 4294960000u;
+  scheduler.start(now);
+  for (int i = 0; i < 20000; ++i) {
+    now += 1; // simulated 1 ms tick
+    scheduler.tick(now);
+  }
+
+  std::printf("fast task runs: %d (expected 2000)\n", fastRuns);
+  std::printf("slow task runs: %d (expected 20)\n", slowRuns);
+  return (fastRuns == 2000 && slowRuns == 20) ? 0 : 1;
+}
+#endif // TASK_SCHEDULER_DEMO
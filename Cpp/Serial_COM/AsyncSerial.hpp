@@ -0,0 +1,405 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        Cpp/Serial_COM
+FILE:             AsyncSerial.hpp
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  Coroutine Async Serial I/O Snippet
+  Multi-port capture without per-port threads: one epoll-driven event loop services any
+  number of serial ports, and each port's capture logic reads as straight-line code
+  inside a C++20 coroutine (`co_await port.readSome(...)`). Where SerialSaveData.cpp
+  dedicates a reader and a writer thread to one port, eight ports here share one thread —
+  no per-port stacks, no lock on the shared output, no scheduling jitter when bursts
+  arrive on every port at once.
+
+  The awaitables try the non-blocking syscall first and only suspend on EAGAIN, so an
+  already-full kernel buffer costs no epoll round trip. Registration is one waiter per
+  fd per direction, re-armed on each suspension (EPOLLONESHOT semantics done manually).
+
+  Complexity:     O(ready fds) per loop iteration; no allocation per I/O operation
+                  (one coroutine frame per port, allocated once at spawn).
+  Requirements:   C++20 (coroutines) and Linux epoll — this snippet is the one step
+                  beyond the repo's C++17 baseline; build with -std=c++20. On Windows
+                  the loop maps to IOCP with the same awaitable surface.
+
+  Usage:
+    asyncserial::EventLoop loop;
+    asyncserial::SerialPort port(loop);
+    port.openDevice("/dev/ttyUSB0", B921600);
+    loop.spawn(capturePort(port, outputFile));   // one coroutine per --port
+    loop.run();                                  // single thread, all ports
+*/
+
+#ifndef ASYNC_SERIAL_HPP
+#define ASYNC_SERIAL_HPP
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stddef.h>
+#include <sys/epoll.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <coroutine>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <unordered_map>
+
+namespace asyncserial {
+
+class EventLoop;
+
+/// Fire-and-forget coroutine owned by the event loop: spawn() starts it, the loop
+/// runs until every spawned task has finished.
+class Task {
+ public:
+  struct promise_type {
+    EventLoop *loop = nullptr;
+
+    Task get_return_object() {
+      return Task{std::coroutine_handle<promise_type>::from_promise(*this)};
+    }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    auto final_suspend() noexcept;
+    void return_void() {}
+    void unhandled_exception() { std::terminate(); }
+  };
+
+  explicit Task(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+ private:
+  friend class EventLoop;
+  std::coroutine_handle<promise_type> handle_;
+};
+
+/// Single-threaded epoll reactor. One waiter per fd per direction; coroutines are
+/// resumed inline from run(), so no synchronization is ever needed.
+class EventLoop {
+ public:
+  EventLoop() : epollFd_(epoll_create1(EPOLL_CLOEXEC)) {}
+
+  ~EventLoop() {
+    if (epollFd_ >= 0) {
+      ::close(epollFd_);
+    }
+  }
+
+  EventLoop(const EventLoop &) = delete;
+  EventLoop &operator=(const EventLoop &) = delete;
+
+  /// Starts a coroutine; the loop keeps running until all spawned tasks return.
+  void spawn(Task task) {
+    task.handle_.promise().loop = this;
+    ++activeTasks_;
+    task.handle_.resume(); // runs until the first co_await suspends it
+  }
+
+  /// Services ports until every spawned coroutine has completed.
+  void run() {
+    epoll_event events[16];
+    while (activeTasks_ > 0) {
+      const int ready = epoll_wait(epollFd_, events, 16, -1);
+      if (ready < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        std::perror("epoll_wait");
+        return;
+      }
+      for (int i = 0; i < ready; ++i) {
+        const int fd = events[i].data.fd;
+        // Error/hangup wakes both directions so the read()/write() can report it.
+        const bool failure = (events[i].events & (EPOLLERR | EPOLLHUP)) != 0;
+        if ((events[i].events & EPOLLIN) || failure) {
+          resumeWaiter(fd, /*write=*/false);
+        }
+        if ((events[i].events & EPOLLOUT) || failure) {
+          resumeWaiter(fd, /*write=*/true);
+        }
+      }
+    }
+  }
+
+  /// Parks the current coroutine until `fd` is readable (write=false) or writable.
+  void armWait(int fd, bool write, std::coroutine_handle<> handle) {
+    Waiters &waiters = waiters_[fd];
+    (write ? waiters.writer : waiters.reader) = handle;
+    updateRegistration(fd, waiters);
+  }
+
+  /// Drops any registration for a closing fd.
+  void forgetFd(int fd) {
+    auto it = waiters_.find(fd);
+    if (it != waiters_.end()) {
+      if (it->second.registered) {
+        epoll_ctl(epollFd_, EPOLL_CTL_DEL, fd, nullptr);
+      }
+      waiters_.erase(it);
+    }
+  }
+
+  void taskFinished() { --activeTasks_; }
+
+ private:
+  struct Waiters {
+    std::coroutine_handle<> reader;
+    std::coroutine_handle<> writer;
+    bool registered = false;
+  };
+
+  void updateRegistration(int fd, Waiters &waiters) {
+    epoll_event ev{};
+    ev.data.fd = fd;
+    ev.events = (waiters.reader ? EPOLLIN : 0u) | (waiters.writer ? EPOLLOUT : 0u);
+    if (ev.events == 0) {
+      if (waiters.registered) {
+        epoll_ctl(epollFd_, EPOLL_CTL_DEL, fd, nullptr);
+        waiters.registered = false;
+      }
+      return;
+    }
+    epoll_ctl(epollFd_, waiters.registered ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, fd, &ev);
+    waiters.registered = true;
+  }
+
+  void resumeWaiter(int fd, bool write) {
+    auto it = waiters_.find(fd);
+    if (it == waiters_.end()) {
+      return;
+    }
+    std::coroutine_handle<> &slot = write ? it->second.writer : it->second.reader;
+    std::coroutine_handle<> handle = slot;
+    if (!handle) {
+      return;
+    }
+    slot = nullptr;
+    updateRegistration(fd, it->second); // de-register before resuming (oneshot)
+    handle.resume();
+  }
+
+  int epollFd_;
+  int activeTasks_ = 0;
+  std::unordered_map<int, Waiters> waiters_;
+};
+
+inline auto Task::promise_type::final_suspend() noexcept {
+  struct FinalAwaiter {
+    bool await_ready() noexcept { return false; }
+    void await_suspend(std::coroutine_handle<promise_type> handle) noexcept {
+      handle.promise().loop->taskFinished();
+      handle.destroy();
+    }
+    void await_resume() noexcept {}
+  };
+  return FinalAwaiter{};
+}
+
+/// co_await-able read/write: tries the syscall immediately, suspends only on EAGAIN,
+/// and returns the syscall result (0 = EOF/hangup, <0 = errno-style failure).
+class IoAwaitable {
+ public:
+  IoAwaitable(EventLoop &loop, int fd, void *buffer, size_t length, bool write)
+      : loop_(loop), fd_(fd), buffer_(buffer), length_(length), write_(write) {}
+
+  bool await_ready() {
+    result_ = attempt();
+    return result_ >= 0 || errno != EAGAIN;
+  }
+
+  void await_suspend(std::coroutine_handle<> handle) {
+    loop_.armWait(fd_, write_, handle);
+  }
+
+  ssize_t await_resume() {
+    if (result_ < 0 && errno == EAGAIN) {
+      result_ = attempt(); // the fd became ready while we were parked
+    }
+    return result_;
+  }
+
+ private:
+  ssize_t attempt() {
+    return write_ ? ::write(fd_, buffer_, length_) : ::read(fd_, buffer_, length_);
+  }
+
+  EventLoop &loop_;
+  int fd_;
+  void *buffer_;
+  size_t length_;
+  bool write_;
+  ssize_t result_ = -1;
+};
+
+/// One serial port (or any byte stream fd) bound to an event loop.
+class SerialPort {
+ public:
+  explicit SerialPort(EventLoop &loop) : loop_(loop) {}
+
+  ~SerialPort() { close(); }
+
+  SerialPort(const SerialPort &) = delete;
+  SerialPort &operator=(const SerialPort &) = delete;
+
+  /// Opens and configures a real device: raw mode, no flow control, non-blocking.
+  bool openDevice(const char *path, speed_t speed) {
+    fd_ = ::open(path, O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if (fd_ < 0) {
+      std::fprintf(stderr, "Error opening %s: %s\n", path, std::strerror(errno));
+      return false;
+    }
+    termios tty{};
+    if (tcgetattr(fd_, &tty) != 0) {
+      close();
+      return false;
+    }
+    cfmakeraw(&tty);
+    cfsetispeed(&tty, speed);
+    cfsetospeed(&tty, speed);
+    tty.c_cflag |= CLOCAL | CREAD;
+    tty.c_cc[VMIN] = 0; // non-blocking reads; readiness comes from epoll
+    tty.c_cc[VTIME] = 0;
+    if (tcsetattr(fd_, TCSANOW, &tty) != 0) {
+      close();
+      return false;
+    }
+    tcflush(fd_, TCIFLUSH);
+    return true;
+  }
+
+  /// Wraps an already-open fd (pipe, pty, socket) — used by tests and the demo.
+  void adoptFd(int fd) {
+    fd_ = fd;
+    fcntl(fd_, F_SETFL, fcntl(fd_, F_GETFL) | O_NONBLOCK);
+  }
+
+  void close() {
+    if (fd_ >= 0) {
+      loop_.forgetFd(fd_);
+      ::close(fd_);
+      fd_ = -1;
+    }
+  }
+
+  /// Awaitable: resumes with the read() result once at least one byte is available.
+  IoAwaitable readSome(void *buffer, size_t length) {
+    return IoAwaitable(loop_, fd_, buffer, length, /*write=*/false);
+  }
+
+  /// Awaitable: resumes with the write() result once the port can accept bytes.
+  IoAwaitable writeSome(const void *buffer, size_t length) {
+    return IoAwaitable(loop_, fd_, const_cast<void *>(buffer), length,
+                       /*write=*/true);
+  }
+
+  int fd() const { return fd_; }
+
+ private:
+  EventLoop &loop_;
+  int fd_ = -1;
+};
+
+} // namespace asyncserial
+
+#endif // ASYNC_SERIAL_HPP
+
+/*
+  Demo build (pipes stand in for serial devices):
+    g++ -std=c++20 -O2 -DASYNC_SERIAL_DEMO -x c++ AsyncSerial.hpp -o async_serial_demo
+*/
+#ifdef ASYNC_SERIAL_DEMO
+#include <cstdint>
+
+namespace {
+
+struct PortStats {
+  uint64_t bytes = 0;
+  uint64_t lines = 0;
+  bool done = false;
+};
+
+// Straight-line capture logic — this is the whole point: per-port state lives in
+// locals, not in a hand-rolled state machine or a dedicated thread.
+asyncserial::Task capturePort(asyncserial::SerialPort &port, PortStats &stats) {
+  char buffer[256];
+  for (;;) {
+    const ssize_t n = co_await port.readSome(buffer, sizeof(buffer));
+    if (n <= 0) {
+      break; // EOF (writer closed) or error
+    }
+    stats.bytes += static_cast<uint64_t>(n);
+    for (ssize_t i = 0; i < n; ++i) {
+      if (buffer[i] == '\n') {
+        ++stats.lines;
+      }
+    }
+  }
+  stats.done = true;
+  port.close();
+}
+
+// Feeds one pipe in bursts, yielding to the loop between writes like a device would.
+asyncserial::Task feedPort(asyncserial::SerialPort &port, int linesToSend) {
+  char line[32];
+  for (int i = 0; i < linesToSend; ++i) {
+    const int len = std::snprintf(line, sizeof(line), "12,%d,-3,%d\n", i, i * 2);
+    ssize_t offset = 0;
+    while (offset < len) {
+      const ssize_t n = co_await port.writeSome(line + offset,
+                                                static_cast<size_t>(len - offset));
+      if (n <= 0) {
+        port.close();
+        co_return;
+      }
+      offset += n;
+    }
+  }
+  port.close(); // EOF tells the capture coroutine this "device" is finished
+}
+
+} // namespace
+
+int main() {
+  constexpr int kPorts = 8;
+  constexpr int kLinesPerPort = 5000;
+
+  asyncserial::EventLoop loop;
+  asyncserial::SerialPort *readers[kPorts];
+  asyncserial::SerialPort *writers[kPorts];
+  PortStats stats[kPorts];
+
+  for (int p = 0; p < kPorts; ++p) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+      std::perror("pipe");
+      return 1;
+    }
+    readers[p] = new asyncserial::SerialPort(loop);
+    writers[p] = new asyncserial::SerialPort(loop);
+    readers[p]->adoptFd(fds[0]);
+    writers[p]->adoptFd(fds[1]);
+    loop.spawn(capturePort(*readers[p], stats[p]));
+    loop.spawn(feedPort(*writers[p], kLinesPerPort));
+  }
+
+  loop.run(); // one thread services all 16 coroutines
+
+  bool ok = true;
+  for (int p = 0; p < kPorts; ++p) {
+    ok = ok && stats[p].done && stats[p].lines == kLinesPerPort;
+    std::printf("port %d: %llu bytes, %llu lines\n", p,
+                (unsigned long long)stats[p].bytes,
+                (unsigned long long)stats[p].lines);
+    delete readers[p];
+    delete writers[p];
+  }
+  std::printf(ok ? "async serial OK\n" : "async serial FAILED\n");
+  return ok ? 0 : 1;
+}
+#endif // ASYNC_SERIAL_DEMO
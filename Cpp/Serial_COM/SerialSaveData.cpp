@@ -0,0 +1,322 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        Cpp/Serial_COM
+FILE:             SerialSaveData.cpp
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  High-Rate Serial Capture Tool
+  Native counterpart of Python/Serial_COM/Serial_SaveData.py for captures where pySerial's
+  per-line readline() plus synchronous writes drop data (921600 baud and above). The serial
+  port is read with raw termios into one half of a preallocated double buffer while a writer
+  thread drains the other half with large block writes, so the capture path never waits on
+  the disk and never allocates.
+
+  Complexity:     O(1) per byte; two fixed 1 MiB buffers, no allocation after startup.
+  Requirements:   C++17, POSIX (termios). On Windows replace openSerialPort() with
+                  CreateFile/SetCommState and read() with ReadFile; the double-buffer
+                  pipeline is platform independent.
+
+  Usage:
+    g++ -std=c++17 -O2 -pthread SerialSaveData.cpp -o serial_save_data
+    ./serial_save_data output.txt --port /dev/ttyUSB0 --baudrate 921600
+    ./serial_save_data data.log --port /dev/ttyACM0 --baudrate 115200 --max-lines 1000
+*/
+
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr const char *kDefaultPort = "/dev/ttyUSB0";
+constexpr long kDefaultBaudrate = 9600;
+constexpr size_t kBufferSize = 1u << 20; // 1 MiB per double-buffer half
+
+std::atomic<bool> g_stopRequested{false};
+
+void handleSignal(int) { g_stopRequested.store(true, std::memory_order_relaxed); }
+
+struct Options {
+  std::string outputFile;
+  std::string port = kDefaultPort;
+  long baudrate = kDefaultBaudrate;
+  long long maxLines = -1; // -1: infinite
+  bool append = false;
+};
+
+bool parseArgs(int argc, char **argv, Options &opts) {
+  if (argc < 2) {
+    return false;
+  }
+  opts.outputFile = argv[1];
+  for (int i = 2; i < argc; ++i) {
+    const std::string arg = argv[i];
+    const bool hasValue = i + 1 < argc;
+    if (arg == "--port" && hasValue) {
+      opts.port = argv[++i];
+    } else if (arg == "--baudrate" && hasValue) {
+      opts.baudrate = std::strtol(argv[++i], nullptr, 10);
+    } else if (arg == "--max-lines" && hasValue) {
+      opts.maxLines = std::strtoll(argv[++i], nullptr, 10);
+    } else if (arg == "--append") {
+      opts.append = true;
+    } else {
+      std::fprintf(stderr, "Unknown or incomplete option: %s\n", arg.c_str());
+      return false;
+    }
+  }
+  return true;
+}
+
+speed_t baudrateToSpeed(long baudrate) {
+  switch (baudrate) {
+    case 9600: return B9600;
+    case 19200: return B19200;
+    case 38400: return B38400;
+    case 57600: return B57600;
+    case 115200: return B115200;
+    case 230400: return B230400;
+#ifdef B460800
+    case 460800: return B460800;
+#endif
+#ifdef B921600
+    case 921600: return B921600;
+#endif
+#ifdef B1500000
+    case 1500000: return B1500000;
+#endif
+    default: return B0;
+  }
+}
+
+int openSerialPort(const std::string &port, long baudrate) {
+  const speed_t speed = baudrateToSpeed(baudrate);
+  if (speed == B0) {
+    std::fprintf(stderr, "Unsupported baud rate: %ld\n", baudrate);
+    return -1;
+  }
+
+  const int fd = ::open(port.c_str(), O_RDONLY | O_NOCTTY);
+  if (fd < 0) {
+    std::fprintf(stderr, "Error opening serial port %s: %s\n", port.c_str(),
+                 std::strerror(errno));
+    return -1;
+  }
+
+  termios tty{};
+  if (tcgetattr(fd, &tty) != 0) {
+    std::fprintf(stderr, "tcgetattr failed: %s\n", std::strerror(errno));
+    ::close(fd);
+    return -1;
+  }
+
+  cfmakeraw(&tty);
+  cfsetispeed(&tty, speed);
+  cfsetospeed(&tty, speed);
+  tty.c_cflag |= CLOCAL | CREAD;
+  tty.c_cc[VMIN] = 0;   // return whatever is available...
+  tty.c_cc[VTIME] = 10; // ...or after a 1 s timeout so CTRL+C stays responsive
+
+  if (tcsetattr(fd, TCSANOW, &tty) != 0) {
+    std::fprintf(stderr, "tcsetattr failed: %s\n", std::strerror(errno));
+    ::close(fd);
+    return -1;
+  }
+
+  tcflush(fd, TCIFLUSH);
+  return fd;
+}
+
+/// One half of the double buffer, handed between reader and writer by index only.
+struct CaptureBuffer {
+  std::vector<uint8_t> data;
+  size_t used = 0;
+};
+
+class DoubleBufferedWriter {
+ public:
+  explicit DoubleBufferedWriter(int outputFd) : outputFd_(outputFd) {
+    buffers_[0].data.resize(kBufferSize);
+    buffers_[1].data.resize(kBufferSize);
+    writerThread_ = std::thread([this] { writerLoop(); });
+  }
+
+  ~DoubleBufferedWriter() { finish(); }
+
+  /// Drains any in-flight buffer, stops the writer thread and reports success.
+  /// Must provide the exit code: swap() returns before the buffer hits the disk,
+  /// so only the post-join writeFailed_ state covers the final flush (ENOSPC on
+  /// the last buffer must not exit 0). Idempotent; the destructor reuses it.
+  bool finish() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      finished_ = true;
+    }
+    readyCv_.notify_one();
+    if (writerThread_.joinable()) {
+      writerThread_.join();
+    }
+    return !writeFailed();
+  }
+
+  /// Capture-side: returns the buffer currently owned by the reader.
+  CaptureBuffer &activeBuffer() { return buffers_[active_]; }
+
+  /// Capture-side: publish the active buffer to the writer and take the other half.
+  /// Blocks only when the disk is more than one full buffer behind.
+  void swap() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    drainedCv_.wait(lock, [this] { return pendingIndex_ < 0; });
+    pendingIndex_ = static_cast<int>(active_);
+    active_ ^= 1u;
+    buffers_[active_].used = 0;
+    readyCv_.notify_one();
+  }
+
+  bool writeFailed() const { return writeFailed_.load(std::memory_order_relaxed); }
+
+ private:
+  void writerLoop() {
+    for (;;) {
+      int index;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        readyCv_.wait(lock, [this] { return pendingIndex_ >= 0 || finished_; });
+        if (pendingIndex_ < 0 && finished_) {
+          return;
+        }
+        index = pendingIndex_;
+      }
+
+      const CaptureBuffer &buffer = buffers_[static_cast<size_t>(index)];
+      size_t written = 0;
+      while (written < buffer.used) {
+        const ssize_t n =
+            ::write(outputFd_, buffer.data.data() + written, buffer.used - written);
+        if (n < 0) {
+          if (errno == EINTR) {
+            continue;
+          }
+          writeFailed_.store(true, std::memory_order_relaxed);
+          break;
+        }
+        written += static_cast<size_t>(n);
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pendingIndex_ = -1;
+      }
+      drainedCv_.notify_one();
+    }
+  }
+
+  int outputFd_;
+  CaptureBuffer buffers_[2];
+  size_t active_ = 0;
+  int pendingIndex_ = -1;
+  bool finished_ = false;
+  std::atomic<bool> writeFailed_{false};
+  std::mutex mutex_;
+  std::condition_variable readyCv_;
+  std::condition_variable drainedCv_;
+  std::thread writerThread_;
+};
+
+int captureLoop(int serialFd, int outputFd, long long maxLines) {
+  DoubleBufferedWriter writer(outputFd);
+  long long linesSeen = 0;
+
+  while (!g_stopRequested.load(std::memory_order_relaxed)) {
+    CaptureBuffer &buffer = writer.activeBuffer();
+    const size_t room = buffer.data.size() - buffer.used;
+    const ssize_t n = ::read(serialFd, buffer.data.data() + buffer.used, room);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      std::fprintf(stderr, "Error reading from the serial port: %s\n", std::strerror(errno));
+      return 1;
+    }
+    if (n == 0) {
+      continue; // VTIME timeout with no data
+    }
+
+    if (maxLines >= 0) {
+      const uint8_t *chunk = buffer.data.data() + buffer.used;
+      for (ssize_t i = 0; i < n; ++i) {
+        if (chunk[i] == '\n' && ++linesSeen >= maxLines) {
+          buffer.used += static_cast<size_t>(i) + 1;
+          writer.swap(); // flush the final partial buffer
+          return writer.finish() ? 0 : 1;
+        }
+      }
+    }
+
+    buffer.used += static_cast<size_t>(n);
+    if (buffer.used == buffer.data.size()) {
+      writer.swap();
+      if (writer.writeFailed()) {
+        std::fprintf(stderr, "I/O error writing the output file.\n");
+        return 1;
+      }
+    }
+  }
+
+  writer.swap(); // flush whatever the last read collected
+  std::fprintf(stderr, "\nLogging interrupted by user.\n");
+  return writer.finish() ? 0 : 1;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  Options opts;
+  if (!parseArgs(argc, argv, opts)) {
+    std::fprintf(stderr,
+                 "Usage: %s output_file [--port PORT] [--baudrate N] [--max-lines N] "
+                 "[--append]\n",
+                 argv[0]);
+    return 1;
+  }
+
+  const int serialFd = openSerialPort(opts.port, opts.baudrate);
+  if (serialFd < 0) {
+    return 1;
+  }
+
+  const int flags = O_WRONLY | O_CREAT | (opts.append ? O_APPEND : O_TRUNC);
+  const int outputFd = ::open(opts.outputFile.c_str(), flags, 0644);
+  if (outputFd < 0) {
+    std::fprintf(stderr, "Error opening output file %s: %s\n", opts.outputFile.c_str(),
+                 std::strerror(errno));
+    ::close(serialFd);
+    return 1;
+  }
+
+  std::signal(SIGINT, handleSignal);
+  std::signal(SIGTERM, handleSignal);
+
+  const int status = captureLoop(serialFd, outputFd, opts.maxLines);
+
+  ::close(outputFd);
+  ::close(serialFd);
+  return status;
+}
@@ -0,0 +1,115 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        STM32/ADXL345_I2C_DMA
+FILE:             adxl345_i2c_dma.cpp
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+#include "adxl345_i2c_dma.h"
+
+namespace {
+
+// Register map shared with the Arduino sketch (Arduino/Sensors/ADXL345).
+constexpr uint8_t REG_BW_RATE = 0x2C;
+constexpr uint8_t REG_POWER_CTL = 0x2D;
+constexpr uint8_t REG_INT_ENABLE = 0x2E;
+constexpr uint8_t REG_INT_MAP = 0x2F;
+constexpr uint8_t REG_DATA_FORMAT = 0x31;
+constexpr uint8_t REG_DATAX0 = 0x32;
+
+constexpr uint8_t MEASURE_BIT = 0x08;
+constexpr uint8_t FULL_RES_BIT = 0x08;
+constexpr uint8_t RANGE_8G = 0x02;
+constexpr uint8_t RATE_800HZ = 0x0D;
+constexpr uint8_t DATA_READY_BIT = 0x80;
+
+constexpr uint32_t kConfigTimeoutMs = 10;
+
+} // namespace
+
+bool Adxl345I2cDma::begin(I2C_HandleTypeDef *hi2c) {
+  hi2c_ = hi2c;
+  head_ = 0;
+  tail_ = 0;
+  readInFlight_ = false;
+  overruns_ = 0;
+
+  if (!writeRegister(REG_POWER_CTL, 0x00)) { // ensure standby
+    return false;
+  }
+  HAL_Delay(5);
+
+  if (!writeRegister(REG_DATA_FORMAT, FULL_RES_BIT | RANGE_8G) ||
+      !writeRegister(REG_BW_RATE, RATE_800HZ) ||
+      !writeRegister(REG_INT_MAP, 0x00) ||          // DATA_READY on INT1
+      !writeRegister(REG_INT_ENABLE, DATA_READY_BIT) ||
+      !writeRegister(REG_POWER_CTL, MEASURE_BIT)) {
+    return false;
+  }
+
+  HAL_Delay(10);
+  return true;
+}
+
+bool Adxl345I2cDma::startRead() {
+  if (hi2c_ == nullptr || readInFlight_) {
+    return false;
+  }
+  readInFlight_ = true;
+
+  if (HAL_I2C_Mem_Read_DMA(hi2c_, kDeviceAddress, REG_DATAX0, I2C_MEMADD_SIZE_8BIT,
+                           rxBuffer_, sizeof(rxBuffer_)) != HAL_OK) {
+    readInFlight_ = false;
+    return false;
+  }
+  return true;
+}
+
+void Adxl345I2cDma::onReadComplete(I2C_HandleTypeDef *hi2c) {
+  if (hi2c != hi2c_) {
+    return;
+  }
+  readInFlight_ = false;
+
+  const int16_t x =
+      static_cast<int16_t>((static_cast<int16_t>(rxBuffer_[1]) << 8) | rxBuffer_[0]);
+  const int16_t y =
+      static_cast<int16_t>((static_cast<int16_t>(rxBuffer_[3]) << 8) | rxBuffer_[2]);
+  const int16_t z =
+      static_cast<int16_t>((static_cast<int16_t>(rxBuffer_[5]) << 8) | rxBuffer_[4]);
+
+  const uint32_t head = head_;
+  if (head - tail_ >= kRingSize) {
+    // Consumer fell behind a full ring: drop the NEWEST sample (this one) and
+    // keep the backlog. Dropping the oldest instead would mean advancing tail_
+    // from this ISR, breaking the only-the-consumer-moves-tail_ invariant that
+    // keeps pop() lock-free; overruns_ lets the main loop detect the stall.
+    ++overruns_;
+    return;
+  }
+
+  Adxl345Sample &slot = ring_[head & (kRingSize - 1)];
+  slot.x = static_cast<float>(x) * kGPerLsb;
+  slot.y = static_cast<float>(y) * kGPerLsb;
+  slot.z = static_cast<float>(z) * kGPerLsb;
+  head_ = head + 1; // commit point: publish the slot to the main loop
+}
+
+bool Adxl345I2cDma::pop(Adxl345Sample &out) {
+  const uint32_t tail = tail_;
+  if (head_ == tail) {
+    return false;
+  }
+  out = ring_[tail & (kRingSize - 1)];
+  tail_ = tail + 1;
+  return true;
+}
+
+bool Adxl345I2cDma::writeRegister(uint8_t reg, uint8_t value) {
+  return HAL_I2C_Mem_Write(hi2c_, kDeviceAddress, reg, I2C_MEMADD_SIZE_8BIT, &value,
+                           1, kConfigTimeoutMs) == HAL_OK;
+}
@@ -0,0 +1,90 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        STM32/UART_DMA_Logger
+FILE:             uart_dma_logger.cpp
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+#include "uart_dma_logger.h"
+
+#include <string.h>
+
+void UartDmaLogger::begin(UART_HandleTypeDef *huart) {
+  huart_ = huart;
+  fill_ = 0;
+  active_ = 0;
+  dmaBusy_ = false;
+  dropped_ = 0;
+}
+
+bool UartDmaLogger::enqueue(const uint8_t *data, size_t length) {
+  if (huart_ == nullptr || length > kBufferSize) {
+    return false;
+  }
+
+  // The commit point must not race with onTxComplete() (runs in the DMA IRQ):
+  // mask interrupts only around the index update, never around the memcpy below
+  // when possible — here both stay inside because the copy is bounded and short
+  // relative to a UART frame at multi-Mbaud.
+  const uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+
+  if (fill_ + length > kBufferSize) {
+    if (dmaBusy_) {
+      // Producer is a full buffer ahead of the wire: drop instead of blocking.
+      ++dropped_;
+      if (primask == 0) {
+        __enable_irq();
+      }
+      return false;
+    }
+    // DMA idle with a full buffer: hand it over and start filling the other one.
+    startTransferLocked();
+  }
+
+  memcpy(&buffers_[active_][fill_], data, length);
+  fill_ = fill_ + length;
+
+  if (!dmaBusy_) {
+    startTransferLocked(); // first record after an idle period: start immediately
+  }
+
+  if (primask == 0) {
+    __enable_irq();
+  }
+  return true;
+}
+
+void UartDmaLogger::onTxComplete(UART_HandleTypeDef *huart) {
+  if (huart != huart_) {
+    return;
+  }
+
+  // IRQ context: the producer's critical section cannot be running concurrently.
+  dmaBusy_ = false;
+  if (fill_ > 0) {
+    startTransferLocked(); // keep the wire saturated back-to-back
+  }
+}
+
+void UartDmaLogger::startTransferLocked() {
+  if (fill_ == 0 || dmaBusy_) {
+    return;
+  }
+
+  const uint8_t sending = active_;
+  const uint16_t length = static_cast<uint16_t>(fill_);
+  active_ = active_ ^ 1u; // producer moves to the other half
+  fill_ = 0;
+  dmaBusy_ = true;
+
+  if (HAL_UART_Transmit_DMA(huart_, buffers_[sending], length) != HAL_OK) {
+    // Peripheral error: surrender the transfer so the producer can retry.
+    dmaBusy_ = false;
+    ++dropped_;
+  }
+}
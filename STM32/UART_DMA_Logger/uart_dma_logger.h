@@ -0,0 +1,77 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        STM32/UART_DMA_Logger
+FILE:             uart_dma_logger.h
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.0
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  DMA Double-Buffered UART Logger Snippet
+  Non-blocking UART TX for high-rate logging: application code enqueues bytes (e.g. the
+  binary records produced by Cpp/Logging/BinaryLog.hpp) with a memcpy into the active
+  ping-pong buffer while the DMA streams the other buffer out of the peripheral. The hot
+  loop never waits on the UART; the only critical section is the few cycles that commit
+  the producer index.
+
+  MCU/board:      STM32F446RE on NUCLEO-F446RE (USART2 -> ST-LINK VCP, DMA1 Stream 6
+                  Channel 4). Any HAL target works once the handles are swapped.
+  Clocks:         tested with the CubeMX default SystemClock_Config at 180 MHz
+                  (HSE bypass 8 MHz, PLL M=4 N=180 P=2), APB1 45 MHz -> up to 5.6 Mbaud.
+  Requirements:   STM32 HAL with UART + DMA enabled (huart initialised in normal DMA
+                  mode, TX stream interrupt enabled).
+
+  Usage (main.cpp):
+    static UartDmaLogger logger;
+    int main() {
+      ...CubeMX init (SystemClock_Config, MX_DMA_Init, MX_USART2_UART_Init)...
+      logger.begin(&huart2);
+      for (;;) {
+        logger.enqueue(record, recordSize);   // returns immediately
+        controlLoopStep();                    // near-zero CPU spent on logging
+      }
+    }
+    // Forward the HAL completion callback:
+    void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart) { logger.onTxComplete(huart); }
+*/
+
+#ifndef UART_DMA_LOGGER_H
+#define UART_DMA_LOGGER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "stm32f4xx_hal.h"
+
+class UartDmaLogger {
+ public:
+  static constexpr size_t kBufferSize = 2048; // per ping-pong half
+
+  /// Binds the logger to an initialised UART handle (DMA TX mode).
+  void begin(UART_HandleTypeDef *huart);
+
+  /// Copies data into the active buffer and kicks the DMA when idle.
+  /// Returns false when both buffers are full (record dropped, counted).
+  bool enqueue(const uint8_t *data, size_t length);
+
+  /// Call from HAL_UART_TxCpltCallback(); swaps buffers and restarts the DMA.
+  void onTxComplete(UART_HandleTypeDef *huart);
+
+  /// Records dropped because the consumer (UART) fell behind.
+  uint32_t droppedRecords() const { return dropped_; }
+
+ private:
+  void startTransferLocked();
+
+  UART_HandleTypeDef *huart_ = nullptr;
+  uint8_t buffers_[2][kBufferSize];
+  volatile size_t fill_ = 0;       // bytes pending in the active buffer
+  volatile uint8_t active_ = 0;    // buffer currently owned by the producer
+  volatile bool dmaBusy_ = false;  // a transfer is in flight on the other buffer
+  volatile uint32_t dropped_ = 0;
+};
+
+#endif // UART_DMA_LOGGER_H
@@ -0,0 +1,547 @@
+/*********************************************************************************************
+PROJECT:          Code Snippets
+COMPONENT:        Tools
+FILE:             build_index.cpp
+AUTHOR:           Ing. Mirko Mirabella
+                  m.mirabella@neptunengineering.com
+                  www.neptunengineering.com
+REVISION:         v. 1.1
+DATE:             27/08/2026
+**********************************************************************************************/
+
+/*
+  Parallel Snippet Indexer
+  Native counterpart of tools/build_index.py for large snippet trees where a single-threaded
+  Python walk takes minutes. One worker thread scans each top-level component (Python/, C/,
+  Cpp/, ...), the README files are memory-mapped for comparison, and only the region between
+  the snippet-index markers is regenerated; untouched READMEs are never rewritten.
+
+  v1.1 adds a persistent index cache (tools/.index_cache.bin, memory-mapped): the previous
+  tree plus one mtime per directory. A directory's mtime only changes when entries are
+  added, removed or renamed inside it, so a warm run stats each known directory once and
+  re-reads only the ones that actually changed — after touching a single snippet the whole
+  run is a handful of stat() calls plus one directory listing, cheap enough to hook into
+  every commit. A missing, stale or truncated cache silently degrades to a full scan.
+
+  Output format matches the Python TreeNode renderer exactly, so the two tools can be used
+  interchangeably.
+
+  Complexity:     cold: O(files) scan, parallel across components; warm: O(directories)
+                  stat calls + O(changed dirs) listings; O(README size) patching.
+  Requirements:   C++17 (<filesystem>, <thread>), POSIX mmap.
+
+  Usage:
+    g++ -std=c++17 -O2 -pthread tools/build_index.cpp -o tools/build_index
+    ./tools/build_index              # run from anywhere inside the repository
+    ./tools/build_index --no-cache   # force a full rescan and rebuild the cache
+*/
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <map>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+const char kMarkerStart[] = "<!-- snippet-index:start -->";
+const char kMarkerEnd[] = "<!-- snippet-index:end -->";
+const char kCacheFileName[] = ".index_cache.bin";
+constexpr uint32_t kCacheMagic = 0x434E4953; // "SNIC"
+constexpr uint32_t kCacheVersion = 1;
+
+struct Section {
+  const char *label;
+  const char *folder;
+  std::vector<std::string> extensions;
+};
+
+const std::vector<Section> kSections = {
+    {"Python", "Python", {".py"}},
+    {"C", "C", {".h", ".c"}},
+    {"Cpp", "Cpp", {".hpp", ".cpp"}},
+    {"MATLAB", "MATLAB", {".m"}},
+    {"Simulink", "Simulink", {".slx"}},
+    {"Arduino", "Arduino", {".ino", ".h", ".cpp"}},
+    {"STM32", "STM32", {".c", ".h", ".cpp"}},
+};
+
+/// Hierarchical view of one component's snippet files (mirrors the Python TreeNode).
+struct TreeNode {
+  std::map<std::string, TreeNode> children;
+  std::set<std::string> files;
+
+  void insert(const std::vector<std::string> &parts, size_t index) {
+    if (index >= parts.size()) {
+      return;
+    }
+    if (index + 1 == parts.size()) {
+      files.insert(parts[index]);
+      return;
+    }
+    children[parts[index]].insert(parts, index + 1);
+  }
+};
+
+/// One directory as the cache sees it: mtime plus the matching files and the
+/// subdirectories found in it last time. Paths are section-relative ("" = base).
+struct DirRecord {
+  int64_t mtimeNs = 0;
+  std::vector<std::string> files;
+  std::vector<std::string> subdirs;
+};
+
+using SectionCache = std::map<std::string, DirRecord>;
+
+fs::path findRepositoryRoot() {
+  fs::path candidate = fs::current_path();
+  while (true) {
+    if (fs::exists(candidate / "README.md") && fs::exists(candidate / "tools")) {
+      return candidate;
+    }
+    if (!candidate.has_parent_path() || candidate.parent_path() == candidate) {
+      return fs::current_path();
+    }
+    candidate = candidate.parent_path();
+  }
+}
+
+int64_t directoryMtimeNs(const fs::path &dir) {
+  struct stat st {};
+  if (::stat(dir.c_str(), &st) != 0) {
+    return -1;
+  }
+  return static_cast<int64_t>(st.st_mtim.tv_sec) * 1000000000 + st.st_mtim.tv_nsec;
+}
+
+bool extensionMatches(const Section &section, const std::string &ext) {
+  return std::find(section.extensions.begin(), section.extensions.end(), ext) !=
+         section.extensions.end();
+}
+
+/// Reads one directory (non-recursive) into a fresh record.
+DirRecord listDirectory(const fs::path &dir, const Section &section) {
+  DirRecord record;
+  record.mtimeNs = directoryMtimeNs(dir);
+  for (const auto &entry : fs::directory_iterator(dir)) {
+    const std::string name = entry.path().filename().string();
+    if (fs::is_directory(entry.symlink_status())) {
+      record.subdirs.push_back(name);
+    } else if (entry.is_regular_file() &&
+               extensionMatches(section, entry.path().extension().string())) {
+      record.files.push_back(name);
+    }
+  }
+  std::sort(record.files.begin(), record.files.end());
+  std::sort(record.subdirs.begin(), record.subdirs.end());
+  return record;
+}
+
+/// Walks one directory tree reusing cached records whose mtime is unchanged;
+/// only changed (or unknown) directories are actually listed.
+void scanDirectory(const fs::path &base, const std::string &relative,
+                   const Section &section, const SectionCache &cached,
+                   SectionCache &fresh, size_t &rescanned) {
+  const fs::path dir = relative.empty() ? base : base / relative;
+  const int64_t mtimeNs = directoryMtimeNs(dir);
+  if (mtimeNs < 0) {
+    return; // disappeared between walk and stat
+  }
+
+  const auto hit = cached.find(relative);
+  DirRecord record;
+  if (hit != cached.end() && hit->second.mtimeNs == mtimeNs) {
+    record = hit->second; // unchanged: one stat, no directory read
+  } else {
+    record = listDirectory(dir, section);
+    ++rescanned;
+  }
+
+  for (const std::string &subdir : record.subdirs) {
+    const std::string childRel = relative.empty() ? subdir : relative + "/" + subdir;
+    scanDirectory(base, childRel, section, cached, fresh, rescanned);
+  }
+  fresh.emplace(relative, std::move(record));
+}
+
+/// Collects section-relative snippet paths ("Sensors/ADXL345/ADXL345.ino"),
+/// incrementally against the cache. Also returns the refreshed cache state.
+std::vector<std::string> collectSectionFiles(const fs::path &root, const Section &section,
+                                             const SectionCache &cached,
+                                             SectionCache &fresh, size_t &rescanned) {
+  std::vector<std::string> collected;
+  const fs::path base = root / section.folder;
+  if (!fs::exists(base)) {
+    return collected;
+  }
+
+  scanDirectory(base, "", section, cached, fresh, rescanned);
+
+  for (const auto &[relative, record] : fresh) {
+    for (const std::string &file : record.files) {
+      collected.push_back(relative.empty() ? file : relative + "/" + file);
+    }
+  }
+  std::sort(collected.begin(), collected.end());
+  return collected;
+}
+
+/* ------------------------------- cache file I/O ------------------------------- */
+
+class CacheReader {
+ public:
+  CacheReader(const char *data, size_t size) : data_(data), size_(size) {}
+
+  bool readU32(uint32_t &value) {
+    if (offset_ + sizeof(value) > size_) {
+      return false;
+    }
+    std::memcpy(&value, data_ + offset_, sizeof(value));
+    offset_ += sizeof(value);
+    return true;
+  }
+
+  bool readI64(int64_t &value) {
+    if (offset_ + sizeof(value) > size_) {
+      return false;
+    }
+    std::memcpy(&value, data_ + offset_, sizeof(value));
+    offset_ += sizeof(value);
+    return true;
+  }
+
+  bool readString(std::string &value) {
+    uint32_t length = 0;
+    if (!readU32(length) || offset_ + length > size_) {
+      return false;
+    }
+    value.assign(data_ + offset_, length);
+    offset_ += length;
+    return true;
+  }
+
+ private:
+  const char *data_;
+  size_t size_;
+  size_t offset_ = 0;
+};
+
+/// Loads the cache (memory-mapped); any inconsistency yields empty caches, which
+/// simply turns the run into a cold full scan.
+std::vector<SectionCache> loadCache(const fs::path &cachePath) {
+  std::vector<SectionCache> caches(kSections.size());
+
+  const int fd = ::open(cachePath.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return caches;
+  }
+  struct stat st {};
+  if (fstat(fd, &st) != 0 || st.st_size == 0) {
+    ::close(fd);
+    return caches;
+  }
+  const size_t size = static_cast<size_t>(st.st_size);
+  void *mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (mapped == MAP_FAILED) {
+    return caches;
+  }
+
+  CacheReader reader(static_cast<const char *>(mapped), size);
+  uint32_t magic = 0;
+  uint32_t version = 0;
+  uint32_t sectionCount = 0;
+  bool valid = reader.readU32(magic) && magic == kCacheMagic &&
+               reader.readU32(version) && version == kCacheVersion &&
+               reader.readU32(sectionCount) && sectionCount == kSections.size();
+
+  for (size_t s = 0; valid && s < kSections.size(); ++s) {
+    std::string folder;
+    uint32_t dirCount = 0;
+    valid = reader.readString(folder) && folder == kSections[s].folder &&
+            reader.readU32(dirCount);
+    for (uint32_t d = 0; valid && d < dirCount; ++d) {
+      std::string relative;
+      DirRecord record;
+      uint32_t fileCount = 0;
+      uint32_t subdirCount = 0;
+      valid = reader.readString(relative) && reader.readI64(record.mtimeNs) &&
+              reader.readU32(fileCount);
+      for (uint32_t f = 0; valid && f < fileCount; ++f) {
+        std::string name;
+        valid = reader.readString(name);
+        record.files.push_back(std::move(name));
+      }
+      valid = valid && reader.readU32(subdirCount);
+      for (uint32_t f = 0; valid && f < subdirCount; ++f) {
+        std::string name;
+        valid = reader.readString(name);
+        record.subdirs.push_back(std::move(name));
+      }
+      if (valid) {
+        caches[s].emplace(std::move(relative), std::move(record));
+      }
+    }
+  }
+  munmap(mapped, size);
+
+  if (!valid) {
+    for (SectionCache &cache : caches) {
+      cache.clear();
+    }
+  }
+  return caches;
+}
+
+void appendU32(std::string &out, uint32_t value) {
+  out.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+void appendI64(std::string &out, int64_t value) {
+  out.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+void appendString(std::string &out, const std::string &value) {
+  appendU32(out, static_cast<uint32_t>(value.size()));
+  out.append(value);
+}
+
+/// Serializes the refreshed tree atomically (temp file + rename).
+bool saveCache(const fs::path &cachePath, const std::vector<SectionCache> &caches) {
+  std::string blob;
+  appendU32(blob, kCacheMagic);
+  appendU32(blob, kCacheVersion);
+  appendU32(blob, static_cast<uint32_t>(kSections.size()));
+  for (size_t s = 0; s < kSections.size(); ++s) {
+    appendString(blob, kSections[s].folder);
+    appendU32(blob, static_cast<uint32_t>(caches[s].size()));
+    for (const auto &[relative, record] : caches[s]) {
+      appendString(blob, relative);
+      appendI64(blob, record.mtimeNs);
+      appendU32(blob, static_cast<uint32_t>(record.files.size()));
+      for (const std::string &name : record.files) {
+        appendString(blob, name);
+      }
+      appendU32(blob, static_cast<uint32_t>(record.subdirs.size()));
+      for (const std::string &name : record.subdirs) {
+        appendString(blob, name);
+      }
+    }
+  }
+
+  const fs::path tempPath = cachePath.string() + ".tmp";
+  std::FILE *out = std::fopen(tempPath.c_str(), "wb");
+  if (out == nullptr) {
+    return false;
+  }
+  const bool written = std::fwrite(blob.data(), 1, blob.size(), out) == blob.size();
+  std::fclose(out);
+  if (!written) {
+    ::unlink(tempPath.c_str());
+    return false;
+  }
+  return ::rename(tempPath.c_str(), cachePath.c_str()) == 0;
+}
+
+/* ------------------------------- index rendering ------------------------------ */
+
+std::vector<std::string> splitPath(const std::string &path) {
+  std::vector<std::string> parts;
+  size_t start = 0;
+  while (start < path.size()) {
+    const size_t slash = path.find('/', start);
+    if (slash == std::string::npos) {
+      parts.push_back(path.substr(start));
+      break;
+    }
+    parts.push_back(path.substr(start, slash - start));
+    start = slash + 1;
+  }
+  return parts;
+}
+
+TreeNode buildTree(const std::vector<std::string> &files) {
+  TreeNode tree;
+  for (const std::string &file : files) {
+    tree.insert(splitPath(file), 0);
+  }
+  return tree;
+}
+
+void renderTreeLines(const TreeNode &node, int level, std::vector<std::string> &lines) {
+  const std::string indent(static_cast<size_t>(level) * 2, ' ');
+  for (const auto &[name, child] : node.children) {
+    lines.push_back(indent + "- `" + name + "`");
+    renderTreeLines(child, level + 1, lines);
+  }
+  for (const std::string &file : node.files) {
+    lines.push_back(indent + "- `" + file + "`");
+  }
+}
+
+/// Inner marker-region lines for the root README (per-section subtrees).
+std::vector<std::string> renderGlobalIndex(const std::vector<std::vector<std::string>> &items) {
+  std::vector<std::string> lines = {"## Snippet index"};
+  std::vector<std::string> content;
+  for (size_t i = 0; i < kSections.size(); ++i) {
+    if (items[i].empty()) {
+      continue;
+    }
+    if (!content.empty()) {
+      content.emplace_back();
+    }
+    content.push_back(std::string("### ") + kSections[i].label);
+    renderTreeLines(buildTree(items[i]), 0, content);
+  }
+  lines.emplace_back();
+  if (content.empty()) {
+    lines.emplace_back("_No snippets found yet._");
+  } else {
+    lines.insert(lines.end(), content.begin(), content.end());
+  }
+  return lines;
+}
+
+/// Inner marker-region lines for a component README.
+std::vector<std::string> renderLocalIndex(const std::vector<std::string> &files) {
+  std::vector<std::string> lines = {"## Snippet index", ""};
+  if (files.empty()) {
+    lines.emplace_back("_No snippets found yet._");
+  } else {
+    renderTreeLines(buildTree(files), 0, lines);
+  }
+  return lines;
+}
+
+/// Replaces the text between the markers; returns false when markers are missing.
+/// The file is memory-mapped so the fast path (index unchanged) touches no disk block.
+bool patchMarkerRegion(const fs::path &readme, const std::vector<std::string> &innerLines) {
+  const int fd = ::open(readme.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+
+  struct stat st {};
+  if (fstat(fd, &st) != 0 || st.st_size == 0) {
+    ::close(fd);
+    return false;
+  }
+  const size_t size = static_cast<size_t>(st.st_size);
+  void *mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (mapped == MAP_FAILED) {
+    return false;
+  }
+
+  const std::string_view content(static_cast<const char *>(mapped), size);
+  const size_t startPos = content.find(kMarkerStart);
+  const size_t endPos = content.find(kMarkerEnd);
+  if (startPos == std::string_view::npos || endPos == std::string_view::npos ||
+      endPos < startPos) {
+    munmap(mapped, size);
+    return false;
+  }
+
+  std::string region;
+  for (const std::string &line : innerLines) {
+    region += line;
+    region += '\n';
+  }
+
+  const size_t innerBegin = startPos + sizeof(kMarkerStart); // marker + its newline
+  const std::string_view currentRegion = content.substr(innerBegin, endPos - innerBegin);
+  if (currentRegion == region) {
+    munmap(mapped, size);
+    return true; // already up to date, nothing rewritten
+  }
+
+  std::string updated;
+  updated.reserve(size + region.size());
+  updated.append(content.substr(0, innerBegin));
+  updated.append(region);
+  updated.append(content.substr(endPos));
+  munmap(mapped, size);
+
+  std::FILE *out = std::fopen(readme.c_str(), "wb");
+  if (out == nullptr) {
+    return false;
+  }
+  const bool ok = std::fwrite(updated.data(), 1, updated.size(), out) == updated.size();
+  std::fclose(out);
+  return ok;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  bool useCache = true;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--no-cache") == 0) {
+      useCache = false;
+    } else {
+      std::fprintf(stderr, "Usage: %s [--no-cache]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  const fs::path root = findRepositoryRoot();
+  const fs::path cachePath = root / "tools" / kCacheFileName;
+  const std::vector<SectionCache> cached =
+      useCache ? loadCache(cachePath) : std::vector<SectionCache>(kSections.size());
+
+  // One scanning worker per top-level component.
+  std::vector<std::vector<std::string>> items(kSections.size());
+  std::vector<SectionCache> fresh(kSections.size());
+  std::atomic<size_t> rescannedDirs{0};
+  std::vector<std::thread> workers;
+  workers.reserve(kSections.size());
+  for (size_t i = 0; i < kSections.size(); ++i) {
+    workers.emplace_back([&, i] {
+      size_t rescanned = 0;
+      items[i] = collectSectionFiles(root, kSections[i], cached[i], fresh[i], rescanned);
+      rescannedDirs.fetch_add(rescanned, std::memory_order_relaxed);
+    });
+  }
+  for (std::thread &worker : workers) {
+    worker.join();
+  }
+
+  bool ok = patchMarkerRegion(root / "README.md", renderGlobalIndex(items));
+  if (!ok) {
+    std::fprintf(stderr, "Warning: could not patch %s\n", (root / "README.md").c_str());
+  }
+
+  size_t totalDirs = 0;
+  for (size_t i = 0; i < kSections.size(); ++i) {
+    totalDirs += fresh[i].size();
+    const fs::path readme = root / kSections[i].folder / "README.md";
+    if (!fs::exists(readme)) {
+      continue;
+    }
+    if (!patchMarkerRegion(readme, renderLocalIndex(items[i]))) {
+      std::fprintf(stderr, "Warning: could not patch %s\n", readme.c_str());
+      ok = false;
+    }
+  }
+
+  if (!saveCache(cachePath, fresh)) {
+    std::fprintf(stderr, "Warning: could not write %s\n", cachePath.c_str());
+  }
+
+  std::printf("README files updated. (%zu of %zu directories rescanned)\n",
+              rescannedDirs.load(), totalDirs);
+  return ok ? 0 : 1;
+}
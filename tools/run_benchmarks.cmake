@@ -0,0 +1,56 @@
+# /*********************************************************************************************
+# PROJECT:          Code Snippets
+# COMPONENT:        Tools
+# FILE:             run_benchmarks.cmake
+# AUTHOR:           Ing. Mirko Mirabella
+#                   m.mirabella@neptunengineering.com
+#                   www.neptunengineering.com
+# REVISION:         v. 1.0
+# DATE:             27/08/2026
+# **********************************************************************************************/
+#
+# Benchmark collector for the `bench` target: runs every benchmark executable with
+# --csv, keeps a single CSV header, tags each row with its benchmark binary and
+# writes one results file to diff between revisions.
+#
+#   cmake -DBENCH_DIR=<dir> -DBENCH_NAMES=<name|name|...> -DOUTPUT_FILE=<csv> \
+#         -P run_benchmarks.cmake
+
+if(NOT DEFINED BENCH_DIR OR NOT DEFINED BENCH_NAMES OR NOT DEFINED OUTPUT_FILE)
+  message(FATAL_ERROR "BENCH_DIR, BENCH_NAMES and OUTPUT_FILE must be defined")
+endif()
+
+string(REPLACE "|" ";" bench_list "${BENCH_NAMES}")
+
+set(results "")
+set(header "")
+foreach(bench_name ${bench_list})
+  message(STATUS "Running ${bench_name}")
+  execute_process(
+    COMMAND ${BENCH_DIR}/${bench_name} --csv
+    OUTPUT_VARIABLE output
+    RESULT_VARIABLE status)
+  if(NOT status EQUAL 0)
+    message(FATAL_ERROR "${bench_name} failed with exit code ${status}")
+  endif()
+
+  string(REPLACE "\n" ";" lines "${output}")
+  set(first_line TRUE)
+  foreach(line ${lines})
+    if(first_line)
+      # Every benchmark prints the same harness header; keep the first only.
+      if(header STREQUAL "")
+        set(header "benchmark,${line}")
+      endif()
+      set(first_line FALSE)
+    elseif(line MATCHES ",")
+      string(APPEND results "${bench_name},${line}\n")
+    else()
+      # Trailing free-form summary lines (GB/s etc.) are not part of the CSV.
+      message(STATUS "  ${line}")
+    endif()
+  endforeach()
+endforeach()
+
+file(WRITE ${OUTPUT_FILE} "${header}\n${results}")
+message(STATUS "Wrote ${OUTPUT_FILE}")